@@ -33,7 +33,9 @@ int main() {
         "!@#$%^&*()"
         "`~-_=+[{]}\\|;:'\",<.>/? ");
     /*<< We use __random_device as a source of entropy, since we want
-         passwords that are not predictable.
+         passwords that are not predictable.  Each value is a request
+         to the operating system, so a program that makes many
+         passwords or tokens should use __secure_engine instead.
     >>*/
     boost::random::random_device rng;
     /*<< Finally we select 8 random characters from the
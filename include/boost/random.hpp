@@ -50,10 +50,21 @@
 #include <boost/random/xor_combine.hpp>
 #include <boost/random/splitmix64.hpp>
 #include <boost/random/xoshiro.hpp>
+#include <boost/random/xoshiro_lanes.hpp>
+#include <boost/random/philox.hpp>
+#include <boost/random/threefry.hpp>
+#include <boost/random/chacha.hpp>
+#include <boost/random/pcg.hpp>
+#include <boost/random/sfc64.hpp>
+#include <boost/random/wyrand.hpp>
+#include <boost/random/romu.hpp>
 
 // misc
 #include <boost/random/generate_canonical.hpp>
+#include <boost/random/split_streams.hpp>
 #include <boost/random/seed_seq.hpp>
+#include <boost/random/static_seed_seq.hpp>
+#include <boost/random/hash_seed_seq.hpp>
 #include <boost/random/random_number_generator.hpp>
 #include <boost/random/variate_generator.hpp>
 
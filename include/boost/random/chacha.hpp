@@ -0,0 +1,565 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_CHACHA_HPP
+#define BOOST_RANDOM_CHACHA_HPP
+
+#include <boost/random/detail/config.hpp>
+#include <boost/random/detail/simd.hpp>
+#include <boost/random/splitmix64.hpp>
+#include <boost/throw_exception.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <ios>
+#include <istream>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// The ChaCha block function written once against the operations in
+// detail/simd.hpp.  With simd_u32_scalar it computes one block; with a
+// vector type each lane computes its own block, x[i] holding word i of
+// every lane.
+template <std::size_t Rounds>
+struct chacha_rounds
+{
+    template <typename V, int a, int b, int c, int d>
+    static void quarter_round(typename V::type* x)
+    {
+        x[a] = V::add(x[a], x[b]); x[d] = V::template rotl<16>(V::bxor(x[d], x[a]));
+        x[c] = V::add(x[c], x[d]); x[b] = V::template rotl<12>(V::bxor(x[b], x[c]));
+        x[a] = V::add(x[a], x[b]); x[d] = V::template rotl<8>(V::bxor(x[d], x[a]));
+        x[c] = V::add(x[c], x[d]); x[b] = V::template rotl<7>(V::bxor(x[b], x[c]));
+    }
+
+    // Computes the block for the input words in, writing it to x.
+    template <typename V>
+    static void apply(typename V::type* x, const typename V::type* in)
+    {
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            x[i] = in[i];
+        }
+
+        for (std::size_t r = 0; r < Rounds; r += 2)
+        {
+            quarter_round<V, 0, 4,  8, 12>(x);
+            quarter_round<V, 1, 5,  9, 13>(x);
+            quarter_round<V, 2, 6, 10, 14>(x);
+            quarter_round<V, 3, 7, 11, 15>(x);
+            quarter_round<V, 0, 5, 10, 15>(x);
+            quarter_round<V, 1, 6, 11, 12>(x);
+            quarter_round<V, 2, 7,  8, 13>(x);
+            quarter_round<V, 3, 4,  9, 14>(x);
+        }
+
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            x[i] = V::add(x[i], in[i]);
+        }
+    }
+};
+
+// Clears key material through a volatile pointer, so that the stores
+// are not removed as dead.  T is a word or a vector type from
+// detail/simd.hpp.
+template <typename T>
+inline void secure_wipe(T* p, std::size_t n) noexcept
+{
+    volatile T* v = p;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = T();
+    }
+}
+
+} // namespace detail
+
+/**
+ * Instantiations of class template @c chacha_engine model a
+ * \pseudo_random_number_generator.  The outputs are the 32-bit words of
+ * the ChaCha keystream described in
+ *
+ *  @blockquote
+ *  "ChaCha, a variant of Salsa20", Daniel J. Bernstein, 2008.
+ *  @endblockquote
+ *
+ * using the original layout: a 256-bit key, a 64-bit block counter and
+ * a 64-bit nonce, called the stream here.  Each block yields sixteen
+ * values.  @c discard() is O(1), @c set_stream() selects one of 2^64
+ * streams for a key and @c set_counter() seeks to a block within it.
+ *
+ * With 20 rounds and a key taken from a source of entropy the output is
+ * cryptographically strong.  Note that the key stays in memory for the
+ * lifetime of the engine and that seeding from an integer leaves only
+ * 64 bits of key material.
+ *
+ * @c generate() computes one block per 32-bit lane with AVX-512, AVX2 or
+ * SSE2 when the translation unit is compiled for them.  Define
+ * @c BOOST_RANDOM_NO_SIMD to force the portable loop.  The output does
+ * not depend on the instruction set.
+ */
+template <std::size_t Rounds>
+class chacha_engine final
+{
+private:
+
+    static_assert(Rounds > 0 && Rounds % 2 == 0, "chacha_engine requires an even, non-zero number of rounds");
+
+    using rounds_type = detail::chacha_rounds<Rounds>;
+    using simd_type = typename detail::simd_select_word<std::uint32_t>::type;
+    using scalar_type = detail::simd_u32_scalar;
+
+    // blocks produced per pass through the stack buffer of generate()
+    static constexpr std::size_t buffer_blocks = 16;
+
+public:
+
+    using result_type = std::uint32_t;
+    using seed_type = std::uint64_t;
+
+    /** The 256-bit key, as taken by @c set_key. */
+    using key_type = std::array<std::uint32_t, 8>;
+
+    /** The 64-bit block counter, as taken by @c set_counter. */
+    using counter_type = std::uint64_t;
+
+    /** The 64-bit nonce, as taken by @c set_stream. */
+    using stream_type = std::uint64_t;
+
+    static constexpr std::size_t word_count = 16;
+    static constexpr std::size_t round_count = Rounds;
+    static constexpr bool has_fixed_range {false};
+
+private:
+
+    key_type key_;
+    counter_type counter_;
+    stream_type stream_;
+    std::array<std::uint32_t, 16> output_;
+    std::size_t index_;
+
+    static void make_input(std::uint32_t* in, const key_type& key, counter_type counter, stream_type stream) noexcept
+    {
+        // "expand 32-byte k"
+        in[0] = UINT32_C(0x61707865);
+        in[1] = UINT32_C(0x3320646e);
+        in[2] = UINT32_C(0x79622d32);
+        in[3] = UINT32_C(0x6b206574);
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            in[4 + i] = key[i];
+        }
+        in[12] = static_cast<std::uint32_t>(counter);
+        in[13] = static_cast<std::uint32_t>(counter >> 32U);
+        in[14] = static_cast<std::uint32_t>(stream);
+        in[15] = static_cast<std::uint32_t>(stream >> 32U);
+    }
+
+    static void compute(const key_type& key, counter_type counter, stream_type stream, std::uint32_t* out) noexcept
+    {
+        std::uint32_t in[16];
+        make_input(in, key, counter, stream);
+        rounds_type::template apply<scalar_type>(out, in);
+        detail::secure_wipe(in, 16);
+    }
+
+    void reset_counter() noexcept
+    {
+        counter_ = 0;
+        index_ = word_count - 1;
+    }
+
+    // Writes whole blocks to out, one block per lane of V.
+    // Returns the number of blocks written.
+    template <typename V>
+    std::size_t run_blocks(std::uint32_t* out, std::size_t blocks, V) noexcept
+    {
+        using vec = typename V::type;
+        constexpr std::size_t lanes = V::width;
+
+        if (blocks < lanes)
+        {
+            return 0;
+        }
+
+        std::uint32_t words[16];
+        make_input(words, key_, 0, stream_);
+        vec in[16];
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+            in[i] = V::set1(words[i]);
+        }
+
+        std::uint32_t offsets[lanes];
+        for (std::size_t l = 0; l < lanes; ++l)
+        {
+            offsets[l] = static_cast<std::uint32_t>(l);
+        }
+        const vec lane_offsets = V::load(offsets);
+
+        alignas(vec) std::uint32_t buf[16][lanes];
+        vec x[16];
+        std::size_t b = 0;
+        for (; b + lanes <= blocks; b += lanes)
+        {
+            const std::uint32_t low = static_cast<std::uint32_t>(counter_);
+            if (low <= UINT32_C(0xFFFFFFFF) - lanes)
+            {
+                // no carry into the high word within this batch
+                in[12] = V::add(V::set1(low), lane_offsets);
+                in[13] = V::set1(static_cast<std::uint32_t>(counter_ >> 32U));
+            }
+            else
+            {
+                for (std::size_t l = 0; l < lanes; ++l)
+                {
+                    buf[12][l] = static_cast<std::uint32_t>(counter_ + l);
+                    buf[13][l] = static_cast<std::uint32_t>((counter_ + l) >> 32U);
+                }
+                in[12] = V::load(buf[12]);
+                in[13] = V::load(buf[13]);
+            }
+            counter_ += lanes;
+
+            rounds_type::template apply<V>(x, in);
+
+            for (std::size_t i = 0; i < 16; ++i)
+            {
+                V::store(buf[i], x[i]);
+            }
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                for (std::size_t i = 0; i < 16; ++i)
+                {
+                    out[(b + l) * 16 + i] = buf[i][l];
+                }
+            }
+        }
+
+        // the inputs hold the key and the rest a copy of the output
+        detail::secure_wipe(words, 16);
+        detail::secure_wipe(in, 16);
+        detail::secure_wipe(x, 16);
+        detail::secure_wipe(reinterpret_cast<vec*>(&buf[0][0]), 16);
+        return b;
+    }
+
+    std::size_t run_blocks(std::uint32_t*, std::size_t, detail::simd_none) noexcept
+    {
+        return 0;
+    }
+
+    void generate_blocks(std::uint32_t* out, std::size_t blocks) noexcept
+    {
+        std::uint32_t* const last = out + blocks * word_count;
+        for (out += run_blocks(out, blocks, simd_type()) * word_count; out != last; out += word_count)
+        {
+            compute(key_, counter_++, stream_, out);
+        }
+    }
+
+    void seed_key(splitmix64& gen) noexcept
+    {
+        for (std::size_t i = 0; i < key_.size(); i += 2)
+        {
+            const std::uint64_t k = gen();
+            key_[i] = static_cast<std::uint32_t>(k);
+            key_[i + 1] = static_cast<std::uint32_t>(k >> 32U);
+        }
+        stream_ = 0;
+        reset_counter();
+    }
+
+public:
+
+    /** Seeds the key using the default seed of boost::random::splitmix64. */
+    void seed()
+    {
+        splitmix64 gen;
+        seed_key(gen);
+    }
+
+    /** Seeds the key from a splitmix64 seeded with @c value. */
+    void seed(const seed_type value)
+    {
+        splitmix64 gen(value);
+        seed_key(gen);
+    }
+
+    /** Seeds the key with eight 32-bit values produced by @c seq.generate(). */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    void seed(Sseq& seq)
+    {
+        seq.generate(key_.begin(), key_.end());
+        stream_ = 0;
+        reset_counter();
+    }
+
+    /** Sets the key using eight values from an iterator range. */
+    template <typename FIter>
+    void seed(FIter first, FIter last)
+    {
+        static_assert(std::is_integral<typename std::iterator_traits<FIter>::value_type>::value,
+                      "Value type must be a built-in integer type" );
+
+        std::size_t offset = 0;
+        while (first != last && offset < key_.size())
+        {
+            key_[offset++] = static_cast<std::uint32_t>(*first++);
+        }
+
+        if (offset != key_.size())
+        {
+            boost::throw_exception(std::invalid_argument("Not enough elements in call to seed."));
+        }
+
+        stream_ = 0;
+        reset_counter();
+    }
+
+    /** Constructs a @c chacha_engine and calls @c seed(). */
+    chacha_engine() { seed(); }
+
+    /** Constructs a @c chacha_engine and calls @c seed(value). */
+    explicit chacha_engine(const seed_type value) { seed(value); }
+
+    template <typename FIter>
+    chacha_engine(FIter& first, FIter last) { seed(first, last); }
+
+    /**
+     * Constructs a @c chacha_engine and calls @c seed(seq).
+     *
+     * @xmlnote
+     * The copy constructor will always be preferred over
+     * the templated constructor.
+     * @endxmlnote
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, chacha_engine>::value, bool>::type = true>
+    explicit chacha_engine(Sseq& seq) { seed(seq); }
+
+    /** Sets the key and resets the stream and the counter to zero. */
+    void set_key(const key_type& key) noexcept
+    {
+        key_ = key;
+        stream_ = 0;
+        reset_counter();
+    }
+
+    /** Selects a stream for the current key and resets the counter to zero. */
+    void set_stream(const stream_type stream) noexcept
+    {
+        stream_ = stream;
+        reset_counter();
+    }
+
+    /** Seeks to the start of the block with the given counter. */
+    void set_counter(const counter_type counter) noexcept
+    {
+        counter_ = counter;
+        index_ = word_count - 1;
+    }
+
+    /**
+     * Clears the key, the counter, the stream and the buffered block
+     * with stores that are not removed as dead, even just before the
+     * engine is destroyed.  Afterwards the engine is in the state that
+     * @c set_key(key_type()) gives.
+     */
+    void wipe() noexcept
+    {
+        detail::secure_wipe(key_.data(), key_.size());
+        detail::secure_wipe(output_.data(), output_.size());
+        detail::secure_wipe(&counter_, 1);
+        detail::secure_wipe(&stream_, 1);
+        index_ = word_count - 1;
+    }
+
+    /**
+     * Returns the sixteen values produced by an engine after
+     * @c set_key(key), @c set_stream(stream) and @c set_counter(counter).
+     */
+    static std::array<result_type, 16> block(const key_type& key, const counter_type counter,
+                                             const stream_type stream = 0) noexcept
+    {
+        std::array<result_type, 16> result;
+        compute(key, counter, stream, result.data());
+        return result;
+    }
+
+    /** Returns the next value of the generator. */
+    inline result_type operator()() noexcept
+    {
+        if (++index_ == word_count)
+        {
+            compute(key_, counter_++, stream_, output_.data());
+            index_ = 0;
+        }
+
+        return output_[index_];
+    }
+
+    /** Fills a range with random values. */
+    template <typename FIter>
+    void generate(FIter first, FIter last)
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        while (first != last && index_ != word_count - 1)
+        {
+            *first++ = static_cast<iter_type>((*this)());
+        }
+
+        std::uint32_t buffer[buffer_blocks * word_count];
+        std::size_t blocks = static_cast<std::size_t>(std::distance(first, last)) / word_count;
+        while (blocks != 0)
+        {
+            const std::size_t count = (std::min)(blocks, buffer_blocks);
+            generate_blocks(buffer, count);
+            for (std::size_t i = 0; i < count * word_count; ++i)
+            {
+                *first++ = static_cast<iter_type>(buffer[i]);
+            }
+            blocks -= count;
+        }
+
+        while (first != last)
+        {
+            *first++ = static_cast<iter_type>((*this)());
+        }
+    }
+
+    /** Fills a contiguous range with random values, writing whole blocks in place. */
+    void generate(std::uint32_t* first, std::uint32_t* last) noexcept
+    {
+        while (first != last && index_ != word_count - 1)
+        {
+            *first++ = (*this)();
+        }
+
+        const std::size_t blocks = static_cast<std::size_t>(last - first) / word_count;
+        generate_blocks(first, blocks);
+        first += blocks * word_count;
+
+        while (first != last)
+        {
+            *first++ = (*this)();
+        }
+    }
+
+    /** Advances the state of the generator by @c z values in O(1) time. */
+    void discard(std::uint64_t z) noexcept
+    {
+        const std::uint64_t offset = z % word_count + index_;
+        const std::uint64_t blocks = z / word_count + offset / word_count;
+        if (blocks != 0)
+        {
+            counter_ += blocks - 1;
+            compute(key_, counter_++, stream_, output_.data());
+        }
+        index_ = static_cast<std::size_t>(offset % word_count);
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    friend bool operator==(const chacha_engine& lhs, const chacha_engine& rhs) noexcept
+    {
+        return lhs.key_ == rhs.key_ && lhs.counter_ == rhs.counter_ &&
+               lhs.stream_ == rhs.stream_ && lhs.index_ == rhs.index_;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    friend bool operator!=(const chacha_engine& lhs, const chacha_engine& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /** Writes the key, the counter, the stream and the position in the current block to a @c std::ostream. */
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& ost,
+                                                         const chacha_engine& e)
+    {
+        for (std::size_t i = 0; i < e.key_.size(); ++i)
+        {
+            ost << e.key_[i] << ' ';
+        }
+        ost << e.counter_ << ' ' << e.stream_ << ' ' << e.index_;
+
+        return ost;
+    }
+
+    /** Reads a @c chacha_engine from a @c std::istream. */
+    template <typename CharT, typename Traits>
+    friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& ist,
+                                                         chacha_engine& e)
+    {
+        chacha_engine tmp;
+        for (std::size_t i = 0; i < tmp.key_.size(); ++i)
+        {
+            ist >> tmp.key_[i] >> std::ws;
+        }
+        ist >> tmp.counter_ >> std::ws >> tmp.stream_ >> std::ws >> tmp.index_;
+
+        if (ist && tmp.index_ >= word_count)
+        {
+            ist.setstate(std::ios_base::failbit);
+        }
+
+        if (ist)
+        {
+            // the current block came from the previous counter
+            if (tmp.index_ != word_count - 1)
+            {
+                compute(tmp.key_, tmp.counter_ - 1, tmp.stream_, tmp.output_.data());
+            }
+            e = tmp;
+        }
+
+        return ist;
+    }
+
+    /** Returns the smallest value that the generator can produce. */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<result_type>::min)();
+    }
+
+    /** Returns the largest value that the generator can produce. */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+};
+
+/** ChaCha with 8 rounds, the fastest variant. */
+using chacha8 = chacha_engine<8>;
+
+/** ChaCha with 12 rounds. */
+using chacha12 = chacha_engine<12>;
+
+/** ChaCha with 20 rounds, as used by the ChaCha20 stream cipher. */
+using chacha20 = chacha_engine<20>;
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_CHACHA_HPP
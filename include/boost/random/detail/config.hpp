@@ -20,3 +20,35 @@
 #if ((defined(__cplusplus) && __cplusplus >= 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)) && (defined(__cpp_hex_float) && __cpp_hex_float >= 201603L)
 #  define BOOST_RANDOM_HAS_HEX_FLOAT
 #endif
+
+// Explicit SIMD kernels are selected from the instruction sets the
+// translation unit is compiled for.  Define BOOST_RANDOM_NO_SIMD to
+// force the portable code paths.
+#if !defined(BOOST_RANDOM_NO_SIMD)
+#  if defined(__AVX512F__)
+#    define BOOST_RANDOM_HAS_AVX512
+#  endif
+#  if defined(__AVX2__)
+#    define BOOST_RANDOM_HAS_AVX2
+#  endif
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define BOOST_RANDOM_HAS_SSE2
+#  endif
+#endif
+
+// Kernels compiled for AVX-512F with the target attribute and chosen at
+// run time, for engines whose hot path is worth it even when the
+// translation unit is built for an older instruction set.  Define
+// BOOST_RANDOM_NO_RUNTIME_DISPATCH to use only what the translation
+// unit is compiled for.
+#if !defined(BOOST_RANDOM_NO_SIMD) && !defined(BOOST_RANDOM_NO_RUNTIME_DISPATCH) && \
+    (defined(__x86_64__) || defined(__i386__)) && \
+    ((defined(__clang__) && __clang_major__ >= 4) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 5))
+#  define BOOST_RANDOM_HAS_AVX512_DISPATCH
+#  define BOOST_RANDOM_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+// Carry-less multiplication, used for GF(2) polynomial arithmetic.
+#if !defined(BOOST_RANDOM_NO_SIMD) && defined(__PCLMUL__) && defined(BOOST_RANDOM_HAS_SSE2)
+#  define BOOST_RANDOM_HAS_PCLMUL
+#endif
@@ -0,0 +1,294 @@
+/* boost random/detail/inversive_congruential_jump.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_DETAIL_INVERSIVE_CONGRUENTIAL_JUMP_HPP
+#define BOOST_RANDOM_DETAIL_INVERSIVE_CONGRUENTIAL_JUMP_HPP
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/random/detail/large_arithmetic.hpp>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// Jump-ahead for x(n+1) = a inv(x(n)) + b (mod p), p an odd prime below
+// 2^32.  On the projective line the step is the Moebius map
+//
+//   (X : Z) -> (a Z + b X : X),
+//
+// so n steps are a power of a 2x2 matrix.  The generator differs from
+// the Moebius map only at 0, which it sends straight to b instead of to
+// the point at infinity.  The number of projective steps to take is
+// therefore z or z+1, depending on whether 0 is among the next z values.
+//
+// To find out, the map is conjugated to a multiplication x -> mu x,
+// using its two fixed points (Hellekalek 1995).  These lie in F_p or in
+// F_p[s]/(s^2 - D), D = b^2 + 4a.  The distance from x to infinity is
+// then a discrete logarithm in a group whose order divides p-1 or p+1,
+// and it is found by Pohlig-Hellman with baby-step giant-step.  When
+// D = 0 the map is conjugated to a translation instead.
+class inversive_congruential_jump
+{
+public:
+    typedef boost::uint64_t value_t;
+
+    static bool supported(value_t a, value_t p)
+    { return a != 0 && p > 2 && p % 2 == 1 && p <= 0xffffffffu; }
+
+    inversive_congruential_jump(value_t a, value_t b, value_t p)
+      : _a(a % p), _b(b % p), _p(p)
+    {
+        BOOST_ASSERT(supported(a, p));
+        _half = (p + 1) / 2;
+        _d = add(mul(_b, _b), mul(4 % p, _a));
+    }
+
+    /** Replaces x by the value z steps later. */
+    void advance(value_t& x, boost::uintmax_t z) const
+    {
+        if(z == 0 || sub(sub(mul(x, x), mul(_b, x)), _a) == 0) {
+            // x is a fixed point
+            return;
+        }
+        boost::uintmax_t order;
+        boost::uintmax_t dist;
+        const bool in_orbit = distance_to_infinity(x, order, dist);
+        boost::uintmax_t n;
+        if(in_orbit) {
+            // the generator skips infinity, so its period is one less
+            z %= order - 1;
+            n = z < dist ? z : z + 1;
+        } else {
+            n = z % order;
+        }
+        x = apply_power(x, n);
+    }
+
+private:
+    typedef std::pair<value_t, value_t> elem;
+
+    value_t add(value_t x, value_t y) const { return (x + y) % _p; }
+    value_t sub(value_t x, value_t y) const { return (x + _p - y) % _p; }
+    value_t mul(value_t x, value_t y) const { return x * y % _p; }
+
+    value_t pow(value_t x, boost::uintmax_t e) const
+    {
+        value_t result = 1;
+        for(; e != 0; e >>= 1) {
+            if(e & 1u) result = mul(result, x);
+            x = mul(x, x);
+        }
+        return result;
+    }
+
+    value_t inv(value_t x) const
+    {
+        BOOST_ASSERT(x != 0);
+        return pow(x, _p - 2);
+    }
+
+    // arithmetic in F_p[s]/(s^2 - D), elements u + v s
+    elem mul(const elem& x, const elem& y) const
+    {
+        return elem(add(mul(x.first, y.first), mul(_d, mul(x.second, y.second))),
+                    add(mul(x.first, y.second), mul(x.second, y.first)));
+    }
+
+    elem pow(elem x, boost::uintmax_t e) const
+    {
+        elem result(1, 0);
+        for(; e != 0; e >>= 1) {
+            if(e & 1u) result = mul(result, x);
+            x = mul(x, x);
+        }
+        return result;
+    }
+
+    elem inv(const elem& x) const
+    {
+        const value_t norm = sub(mul(x.first, x.first),
+                                 mul(_d, mul(x.second, x.second)));
+        const value_t ni = inv(norm);
+        return elem(mul(x.first, ni), mul(sub(0, x.second), ni));
+    }
+
+    // (x - e1) / (x - e2) with e1, e2 = (b +- s) / 2
+    elem conjugate(value_t x) const
+    {
+        const value_t u = sub(x, mul(_b, _half));
+        return mul(elem(u, sub(0, _half)), inv(elem(u, _half)));
+    }
+
+    // x advanced by n steps of the Moebius map, x and the result finite
+    value_t apply_power(value_t x, boost::uintmax_t n) const
+    {
+        // r = M^n with M = [[b, a], [1, 0]]
+        value_t r00 = 1, r01 = 0, r10 = 0, r11 = 1;
+        value_t m00 = _b, m01 = _a, m10 = 1, m11 = 0;
+        for(; n != 0; n >>= 1) {
+            if(n & 1u) {
+                const value_t t00 = add(mul(r00, m00), mul(r01, m10));
+                const value_t t01 = add(mul(r00, m01), mul(r01, m11));
+                const value_t t10 = add(mul(r10, m00), mul(r11, m10));
+                const value_t t11 = add(mul(r10, m01), mul(r11, m11));
+                r00 = t00; r01 = t01; r10 = t10; r11 = t11;
+            }
+            const value_t t00 = add(mul(m00, m00), mul(m01, m10));
+            const value_t t01 = add(mul(m00, m01), mul(m01, m11));
+            const value_t t10 = add(mul(m10, m00), mul(m11, m10));
+            const value_t t11 = add(mul(m10, m01), mul(m11, m11));
+            m00 = t00; m01 = t01; m10 = t10; m11 = t11;
+        }
+        const value_t num = add(mul(r00, x), r01);
+        const value_t den = add(mul(r10, x), r11);
+        return mul(num, inv(den));
+    }
+
+    // Sets order to the length of the orbits of the Moebius map and
+    // dist to the number of steps from x to infinity.  Returns false
+    // if infinity is not in the orbit of x.
+    bool distance_to_infinity(value_t x, boost::uintmax_t& order,
+                              boost::uintmax_t& dist) const
+    {
+        if(_d == 0) {
+            // psi(x) = 1/(x - b/2) turns the map into psi -> psi + 2/b
+            // and psi(infinity) = 0.
+            const value_t psi = inv(sub(x, mul(_b, _half)));
+            const value_t tau = mul(2, inv(_b));
+            order = _p;
+            dist = mul(sub(0, psi), inv(tau));
+            return true;
+        }
+        const bool split = pow(_d, (_p - 1) / 2) == 1;
+        std::vector<boost::uintmax_t> primes = factor(split ? _p - 1 : _p + 1);
+        // conjugate(infinity) = 1, so mu is the image of the first step
+        const elem mu = conjugate(_b);
+        order = split ? _p - 1 : _p + 1;
+        for(std::size_t i = 0; i < primes.size(); ++i) {
+            while(order % primes[i] == 0 &&
+                  pow(mu, order / primes[i]) == elem(1, 0)) {
+                order /= primes[i];
+            }
+        }
+        const elem target = inv(conjugate(x));
+        if(pow(target, order) != elem(1, 0)) {
+            return false;
+        }
+        dist = log(mu, target, order, primes);
+        return true;
+    }
+
+    static std::vector<boost::uintmax_t> factor(boost::uintmax_t n)
+    {
+        std::vector<boost::uintmax_t> result;
+        for(boost::uintmax_t q = 2; q * q <= n; q += (q == 2 ? 1 : 2)) {
+            if(n % q == 0) {
+                result.push_back(q);
+                do { n /= q; } while(n % q == 0);
+            }
+        }
+        if(n > 1) result.push_back(n);
+        return result;
+    }
+
+    // Pohlig-Hellman: returns k with g^k = h, g of the given order
+    boost::uintmax_t log(const elem& g, const elem& h, boost::uintmax_t order,
+                         const std::vector<boost::uintmax_t>& primes) const
+    {
+        boost::uintmax_t result = 0;
+        boost::uintmax_t modulus = 1;
+        for(std::size_t i = 0; i < primes.size(); ++i) {
+            const boost::uintmax_t q = primes[i];
+            boost::uintmax_t qe = 1;
+            while(order % (qe * q) == 0) qe *= q;
+            if(qe == 1) continue;
+            // k mod q^e, one base q digit at a time
+            const elem gamma = pow(g, order / q);
+            const elem g_inv = inv(g);
+            boost::uintmax_t k = 0;
+            boost::uintmax_t qj = 1;
+            while(qj < qe) {
+                const elem hj = pow(mul(h, pow(g_inv, k)), order / qj / q);
+                k += log_prime(gamma, hj, q) * qj;
+                qj *= q;
+            }
+            // combine with the previous residues
+            const boost::uintmax_t t =
+                mulmod((k + qe - result % qe) % qe, invert(modulus % qe, qe), qe);
+            result += modulus * t;
+            modulus *= qe;
+        }
+        return result;
+    }
+
+    // baby-step giant-step for g of prime order q
+    boost::uintmax_t log_prime(const elem& g, const elem& h, boost::uintmax_t q) const
+    {
+        boost::uintmax_t m = 1;
+        while(m * m < q) ++m;
+        std::vector<std::pair<value_t, boost::uintmax_t> > baby;
+        baby.reserve(static_cast<std::size_t>(m));
+        elem cur(1, 0);
+        for(boost::uintmax_t j = 0; j < m; ++j) {
+            baby.push_back(std::make_pair(key(cur), j));
+            cur = mul(cur, g);
+        }
+        std::sort(baby.begin(), baby.end());
+        const elem giant = inv(cur);
+        elem y = h;
+        for(boost::uintmax_t i = 0; i < m; ++i) {
+            std::vector<std::pair<value_t, boost::uintmax_t> >::const_iterator pos =
+                std::lower_bound(baby.begin(), baby.end(), std::make_pair(key(y), boost::uintmax_t(0)));
+            if(pos != baby.end() && pos->first == key(y)) {
+                return (i * m + pos->second) % q;
+            }
+            y = mul(y, giant);
+        }
+        BOOST_ASSERT(!"logarithm not found");
+        return 0;
+    }
+
+    static value_t key(const elem& x) { return (x.first << 32) | x.second; }
+
+    // inverse of x modulo n, gcd(x, n) = 1
+    static boost::uintmax_t invert(boost::uintmax_t x, boost::uintmax_t n)
+    {
+        boost::intmax_t t0 = 0, t1 = 1;
+        boost::uintmax_t r0 = n, r1 = x % n;
+        while(r1 != 0) {
+            const boost::uintmax_t q = r0 / r1;
+            const boost::intmax_t t2 = t0 - static_cast<boost::intmax_t>(q) * t1;
+            t0 = t1; t1 = t2;
+            const boost::uintmax_t r2 = r0 - q * r1;
+            r0 = r1; r1 = r2;
+        }
+        return t0 < 0 ? static_cast<boost::uintmax_t>(t0 + static_cast<boost::intmax_t>(n))
+                      : static_cast<boost::uintmax_t>(t0);
+    }
+
+    value_t _a;
+    value_t _b;
+    value_t _p;
+    value_t _half;
+    value_t _d;
+};
+
+} // namespace detail
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_DETAIL_INVERSIVE_CONGRUENTIAL_JUMP_HPP
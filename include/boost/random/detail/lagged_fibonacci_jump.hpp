@@ -0,0 +1,202 @@
+/* boost random/detail/lagged_fibonacci_jump.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_DETAIL_LAGGED_FIBONACCI_JUMP_HPP
+#define BOOST_RANDOM_DETAIL_LAGGED_FIBONACCI_JUMP_HPP
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// Jump-ahead for the recurrence x(n) = x(n-p) + x(n-q) (mod 2^w), w <= 64.
+// All arithmetic is done modulo 2^64 and the caller masks the result to
+// w bits, which is exact because 2^w divides 2^64.
+//
+// The characteristic polynomial is f(t) = t^p - t^(p-q) - 1.  With
+// g(t) = t^n mod f, every window of the sequence satisfies
+// x(n+j) = sum_i g_i x(i+j), so the window starting n steps later is
+// the middle product of g with the 2p-1 terms following the current
+// window.  Both the powering and the middle product use Karatsuba
+// multiplication, so a jump costs O(p^1.59 log n) instead of O(n).
+class lagged_fibonacci_jump
+{
+public:
+    typedef boost::uint64_t digit_t;
+
+    // Replaces the window y[0, p) by the window n steps later.
+    static void apply(digit_t* y, unsigned p, unsigned q, boost::uintmax_t n)
+    {
+        std::vector<digit_t> scratch(scratch_size(p));
+        std::vector<digit_t> g(p);
+        power(&g[0], p, q, n, &scratch[0]);
+
+        // ext holds the window followed by the next p-1 terms, reversed
+        std::vector<digit_t> ext(2*p);
+        std::reverse_copy(y, y + p, &ext[p - 1]);
+        for(unsigned j = p; j < 2*p - 1; ++j) {
+            ext[2*p - 2 - j] = ext[2*p - 2 - (j - p)] + ext[2*p - 2 - (j - q)];
+        }
+        ext[2*p - 1] = 0;
+
+        // coefficient 2p-2-j of g * ext is the new y[j]
+        std::vector<digit_t> lo(2*p - 1), hi(2*p - 1);
+        multiply(&lo[0], &g[0], &ext[0], p, &scratch[0]);
+        multiply(&hi[0], &g[0], &ext[p], p, &scratch[0]);
+        for(unsigned j = 0; j < p; ++j) {
+            const unsigned m = 2*p - 2 - j;
+            y[j] = lo[m] + (m >= p ? hi[m - p] : 0);
+        }
+    }
+
+    // Rough number of multiply-adds done by apply() for a jump of n,
+    // used to decide when it beats stepping.
+    static boost::uintmax_t cost(unsigned p, boost::uintmax_t n)
+    {
+        unsigned squarings = 0;
+        for(boost::uintmax_t e = n; e >= p; e >>= 1) {
+            ++squarings;
+        }
+        return (squarings + 2) * multiply_cost(p);
+    }
+
+private:
+    BOOST_STATIC_CONSTANT(std::size_t, karatsuba_cutoff = 32);
+
+    static std::size_t scratch_size(std::size_t n)
+    {
+        std::size_t result = 0;
+        while(n > karatsuba_cutoff) {
+            const std::size_t h = n - n/2;
+            result += 4*h;
+            n = h;
+        }
+        return result + 1;
+    }
+
+    static boost::uintmax_t multiply_cost(std::size_t n)
+    {
+        if(n <= karatsuba_cutoff) {
+            return n * n;
+        }
+        const std::size_t h = n - n/2;
+        return 3 * multiply_cost(h) + 4 * n;
+    }
+
+    // r[0, 2n-1) = a[0, n) * b[0, n)
+    static void multiply(digit_t* r, const digit_t* a, const digit_t* b,
+                         std::size_t n, digit_t* scratch)
+    {
+        if(n <= karatsuba_cutoff) {
+            std::fill(r, r + 2*n - 1, digit_t(0));
+            if(a == b) {
+                // squaring: each cross term appears twice
+                for(std::size_t i = 0; i < n; ++i) {
+                    const digit_t ai = a[i];
+                    const digit_t twice = ai + ai;
+                    r[2*i] += ai * ai;
+                    for(std::size_t j = i + 1; j < n; ++j) {
+                        r[i + j] += twice * a[j];
+                    }
+                }
+                return;
+            }
+            for(std::size_t i = 0; i < n; ++i) {
+                const digit_t ai = a[i];
+                for(std::size_t j = 0; j < n; ++j) {
+                    r[i + j] += ai * b[j];
+                }
+            }
+            return;
+        }
+        const std::size_t m = n/2;
+        const std::size_t h = n - m;
+        multiply(r, a, b, m, scratch);
+        r[2*m - 1] = 0;
+        multiply(r + 2*m, a + m, b + m, h, scratch);
+
+        digit_t* sa = scratch;
+        digit_t* sb = scratch + h;
+        digit_t* mid = scratch + 2*h;
+        for(std::size_t i = 0; i < m; ++i) {
+            sa[i] = a[i] + a[m + i];
+            sb[i] = b[i] + b[m + i];
+        }
+        if(h > m) {
+            sa[m] = a[2*m];
+            sb[m] = b[2*m];
+        }
+        // keep squarings recognizable in the recursion
+        multiply(mid, sa, a == b ? sa : sb, h, scratch + 4*h);
+        for(std::size_t i = 0; i < 2*m - 1; ++i) {
+            mid[i] -= r[i];
+        }
+        for(std::size_t i = 0; i < 2*h - 1; ++i) {
+            mid[i] -= r[2*m + i];
+        }
+        for(std::size_t i = 0; i < 2*h - 1; ++i) {
+            r[m + i] += mid[i];
+        }
+    }
+
+    // Reduces r[0, 2p-1) modulo f in place.
+    static void reduce(digit_t* r, unsigned p, unsigned q)
+    {
+        for(unsigned t = 2*p - 2; t >= p; --t) {
+            const digit_t c = r[t];
+            r[t - p] += c;
+            r[t - q] += c;
+        }
+    }
+
+    // g[0, p) = t^n mod f
+    static void power(digit_t* g, unsigned p, unsigned q,
+                      boost::uintmax_t n, digit_t* scratch)
+    {
+        int bit = 0;
+        while(bit < std::numeric_limits<boost::uintmax_t>::digits - 1 &&
+              (n >> (bit + 1)) >= p) {
+            ++bit;
+        }
+        std::fill(g, g + p, digit_t(0));
+        if(n < p) {
+            g[n] = 1;
+            return;
+        }
+        g[static_cast<unsigned>(n >> (bit + 1))] = 1;
+        std::vector<digit_t> sq(2*p - 1);
+        for(; bit >= 0; --bit) {
+            multiply(&sq[0], g, g, p, scratch);
+            reduce(&sq[0], p, q);
+            if((n >> bit) & 1u) {
+                // multiply by t: the coefficient shifted out is t^p = t^(p-q) + 1
+                const digit_t c = sq[p - 1];
+                std::copy_backward(&sq[0], &sq[p - 1], &sq[p]);
+                sq[0] = c;
+                sq[p - q] += c;
+            }
+            std::copy(&sq[0], &sq[p], g);
+        }
+    }
+};
+
+} // namespace detail
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_DETAIL_LAGGED_FIBONACCI_JUMP_HPP
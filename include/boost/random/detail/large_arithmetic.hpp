@@ -18,6 +18,10 @@
 #include <boost/limits.hpp>
 #include <boost/random/detail/integer_log2.hpp>
 
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(BOOST_HAS_INT128)
+#include <intrin.h>
+#endif
+
 #include <boost/random/detail/disable_warnings.hpp>
 
 namespace boost {
@@ -113,6 +117,120 @@ inline boost::uintmax_t muldiv(boost::uintmax_t a, boost::uintmax_t b, boost::ui
 inline boost::uintmax_t mulmod(boost::uintmax_t a, boost::uintmax_t b, boost::uintmax_t m)
 { return detail::muldivmod(a, b, m).remainder; }
 
+// Returns the low 64 bits of the full product a*b and stores
+// the high 64 bits in hi.
+inline boost::uint64_t umul128(boost::uint64_t a, boost::uint64_t b, boost::uint64_t& hi)
+{
+#if defined(BOOST_HAS_INT128)
+    boost::uint128_type product = static_cast<boost::uint128_type>(a) * b;
+    hi = static_cast<boost::uint64_t>(product >> 64);
+    return static_cast<boost::uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, &hi);
+#else
+    const boost::uint64_t mask = 0xFFFFFFFFu;
+    boost::uint64_t a0 = a & mask, a1 = a >> 32;
+    boost::uint64_t b0 = b & mask, b1 = b >> 32;
+    boost::uint64_t p00 = a0 * b0, p01 = a0 * b1;
+    boost::uint64_t p10 = a1 * b0, p11 = a1 * b1;
+    boost::uint64_t middle = (p00 >> 32) + (p01 & mask) + (p10 & mask);
+    hi = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+    return (middle << 32) | (p00 & mask);
+#endif
+}
+
+#if defined(BOOST_HAS_INT128)
+
+typedef boost::uint128_type uint128;
+
+inline uint128 make_uint128(boost::uint64_t hi, boost::uint64_t lo)
+{
+    return (static_cast<uint128>(hi) << 64) | lo;
+}
+
+inline boost::uint64_t high_bits(uint128 x)
+{
+    return static_cast<boost::uint64_t>(x >> 64);
+}
+
+inline boost::uint64_t low_bits(uint128 x)
+{
+    return static_cast<boost::uint64_t>(x);
+}
+
+#else
+
+// An unsigned 128-bit integer with wrap-around arithmetic, providing
+// only the operations needed by 128-bit linear congruential state.
+class uint128
+{
+public:
+    uint128() : _hi(0), _lo(0) {}
+    uint128(boost::uint64_t x) : _hi(0), _lo(x) {}
+    uint128(boost::uint64_t hi, boost::uint64_t lo) : _hi(hi), _lo(lo) {}
+
+    boost::uint64_t high() const { return _hi; }
+    boost::uint64_t low() const { return _lo; }
+
+    friend uint128 operator+(const uint128& a, const uint128& b)
+    {
+        boost::uint64_t lo = a._lo + b._lo;
+        return uint128(a._hi + b._hi + (lo < a._lo), lo);
+    }
+    friend uint128 operator*(const uint128& a, const uint128& b)
+    {
+        boost::uint64_t hi;
+        boost::uint64_t lo = umul128(a._lo, b._lo, hi);
+        return uint128(hi + a._hi * b._lo + a._lo * b._hi, lo);
+    }
+    friend uint128 operator^(const uint128& a, const uint128& b)
+    { return uint128(a._hi ^ b._hi, a._lo ^ b._lo); }
+    friend uint128 operator|(const uint128& a, const uint128& b)
+    { return uint128(a._hi | b._hi, a._lo | b._lo); }
+    friend uint128 operator&(const uint128& a, const uint128& b)
+    { return uint128(a._hi & b._hi, a._lo & b._lo); }
+    friend uint128 operator<<(const uint128& a, int n)
+    {
+        if(n == 0) return a;
+        if(n >= 64) return uint128(a._lo << (n - 64), 0);
+        return uint128((a._hi << n) | (a._lo >> (64 - n)), a._lo << n);
+    }
+    friend uint128 operator>>(const uint128& a, int n)
+    {
+        if(n == 0) return a;
+        if(n >= 64) return uint128(0, a._hi >> (n - 64));
+        return uint128(a._hi >> n, (a._lo >> n) | (a._hi << (64 - n)));
+    }
+    uint128& operator+=(const uint128& other) { return *this = *this + other; }
+    uint128& operator*=(const uint128& other) { return *this = *this * other; }
+    uint128& operator>>=(int n) { return *this = *this >> n; }
+    friend bool operator==(const uint128& a, const uint128& b)
+    { return a._hi == b._hi && a._lo == b._lo; }
+    friend bool operator!=(const uint128& a, const uint128& b)
+    { return !(a == b); }
+private:
+    boost::uint64_t _hi;
+    boost::uint64_t _lo;
+};
+
+inline uint128 make_uint128(boost::uint64_t hi, boost::uint64_t lo)
+{
+    return uint128(hi, lo);
+}
+
+inline boost::uint64_t high_bits(const uint128& x)
+{
+    return x.high();
+}
+
+inline boost::uint64_t low_bits(const uint128& x)
+{
+    return x.low();
+}
+
+#endif
+
+
 } // namespace detail
 } // namespace random
 } // namespace boost
@@ -19,6 +19,13 @@
 #include <algorithm>
 #include <boost/assert.hpp>
 #include <boost/cstdint.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/random/detail/config.hpp>
+
+#ifdef BOOST_RANDOM_HAS_PCLMUL
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
 
 namespace boost {
 namespace random {
@@ -53,8 +60,48 @@ public:
         output[size] ^= (prev >> (bits-shift));
     }
 
+#ifdef BOOST_RANDOM_HAS_PCLMUL
+    // PCLMULQDQ works on 64-bit digits only.
+    typedef boost::integral_constant<bool,
+        std::numeric_limits<digit_t>::digits == 64> use_clmul;
+#else
+    typedef boost::false_type use_clmul;
+#endif
+
     static void multiply_simple(std::size_t size, const digit_t * lhs,
                                    const digit_t * rhs, digit_t * output)
+    {
+        multiply_simple(size, lhs, rhs, output, use_clmul());
+    }
+
+#ifdef BOOST_RANDOM_HAS_PCLMUL
+    // Schoolbook multiplication, one output digit at a time.  Each
+    // column is the xor of the 128-bit products of the digit pairs
+    // that contribute to it; its high half carries into the next one.
+    static void multiply_simple(std::size_t size, const digit_t * lhs,
+                                const digit_t * rhs, digit_t * output,
+                                boost::true_type)
+    {
+        __m128i carry = _mm_setzero_si128();
+        for(std::size_t col = 0; col < 2*size - 1; ++col) {
+            std::size_t first = col < size ? 0 : col - size + 1;
+            std::size_t last = col < size ? col : size - 1;
+            __m128i acc = carry;
+            for(std::size_t i = first; i <= last; ++i) {
+                __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lhs + i));
+                __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rhs + col - i));
+                acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(a, b, 0x00));
+            }
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output + col), acc);
+            carry = _mm_srli_si128(acc, 8);
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + 2*size - 1), carry);
+    }
+#endif
+
+    static void multiply_simple(std::size_t size, const digit_t * lhs,
+                                const digit_t * rhs, digit_t * output,
+                                boost::false_type)
     {
         std::size_t bits = std::numeric_limits<digit_t>::digits;
         for(std::size_t i = 0; i < 2*size; ++i) {
@@ -74,7 +121,9 @@ public:
                                const digit_t * lhs, const digit_t * rhs,
                                digit_t * output)
     {
-        if(size < 64) {
+        // With a hardware multiply the schoolbook method stays
+        // competitive for longer.
+        if(size < (use_clmul::value ? 32 : 64)) {
             multiply_simple(size, lhs, rhs, output);
             return;
         }
@@ -188,13 +237,33 @@ public:
     }
 
     static void sqr(digit_t * val, std::size_t size)
+    {
+        sqr(val, size, use_clmul());
+    }
+
+#ifdef BOOST_RANDOM_HAS_PCLMUL
+    static void sqr(digit_t * val, std::size_t size, boost::true_type)
+    {
+        // backwards, since the result overwrites the input
+        for(std::size_t i = size; i-- > 0;) {
+            __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(val + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(val + 2*i),
+                             _mm_clmulepi64_si128(x, x, 0x00));
+        }
+    }
+#endif
+
+    static void sqr(digit_t * val, std::size_t size, boost::false_type)
     {
         const std::size_t bits = std::numeric_limits<digit_t>::digits;
         digit_t mask = (digit_t(1) << bits/2) - 1;
-        for(std::size_t i = 0; i < size; ++i) {
-            digit_t x = val[size - i - 1];
-            val[(size - i - 1) * 2] = sqr(x & mask);
-            val[(size - i - 1) * 2 + 1] = sqr(x >> bits/2);
+        // backwards, since the result overwrites the input.  GCC 12.2
+        // at -O1 marks the equivalent loop indexed by size - i - 1 as
+        // pure after ivopts and drops calls to it; keep this form.
+        for(std::size_t i = size; i-- > 0;) {
+            digit_t x = val[i];
+            val[i * 2] = sqr(x & mask);
+            val[i * 2 + 1] = sqr(x >> bits/2);
         }
     }
 
@@ -377,6 +446,50 @@ inline polynomial mod_pow_x(boost::uintmax_t exponent, polynomial mod)
     return result;
 }
 
+// Berlekamp-Massey: returns the minimal polynomial p(t) of the first
+// length bits of the linearly recurrent sequence seq, i.e. if
+// p(t) = \sum_{i=0}^{L}p_i t^i, then \sum_{i=0}^{L}p_i seq[n+i] = 0
+// for all n.  length should be at least twice the degree of the
+// recurrence.
+inline polynomial minimal_polynomial(const polynomial &seq, std::size_t length)
+{
+    // connection polynomial c(t) and the previous one, b(t).
+    polynomial c, b;
+    c[0] = 1;
+    b[0] = 1;
+    std::size_t degree = 0;
+    std::size_t shift = 1;
+    for(std::size_t n = 0; n < length; ++n) {
+        bool d = seq[n];
+        for(std::size_t i = 1; i <= degree; ++i) {
+            d ^= (c[i] && seq[n - i]);
+        }
+        if(!d) {
+            ++shift;
+        } else if(2 * degree <= n) {
+            polynomial tmp = c;
+            for(std::size_t i = 0; i < b.size(); ++i) {
+                if(b[i]) c[i + shift] ^= true;
+            }
+            degree = n + 1 - degree;
+            b = tmp;
+            shift = 1;
+        } else {
+            for(std::size_t i = 0; i < b.size(); ++i) {
+                if(b[i]) c[i + shift] ^= true;
+            }
+            ++shift;
+        }
+    }
+    // p(t) = t^L c(1/t)
+    polynomial result;
+    result[degree] = 1;
+    for(std::size_t i = 0; i <= degree; ++i) {
+        result[degree - i] = c[i];
+    }
+    return result;
+}
+
 }
 }
 }
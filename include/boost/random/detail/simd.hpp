@@ -0,0 +1,358 @@
+/* boost random/detail/simd.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_DETAIL_SIMD_HPP
+#define BOOST_RANDOM_DETAIL_SIMD_HPP
+
+#include <boost/random/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(BOOST_RANDOM_HAS_AVX2) || defined(BOOST_RANDOM_HAS_AVX512) || defined(BOOST_RANDOM_HAS_AVX512_DISPATCH)
+#include <immintrin.h>
+#elif defined(BOOST_RANDOM_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// Thin wrappers around the integer vector operations used by the
+// bulk generation kernels.  Each kernel is written once against this
+// interface and instantiated for the widest vector type available, with
+// simd_u64_scalar as the portable fallback.  Loads and stores are
+// unaligned; callers keep lane data contiguous.  mul32 is the full
+// 64-bit product of the low 32 bits of each lane.
+
+struct simd_u64_scalar
+{
+    typedef std::uint64_t type;
+    static const std::size_t width = 1;
+
+    static type load(const std::uint64_t* p) { return *p; }
+    static void store(std::uint64_t* p, type x) { *p = x; }
+    static type set1(std::uint64_t x) { return x; }
+    static type add(type a, type b) { return a + b; }
+    static type sub(type a, type b) { return a - b; }
+    static type mul32(type a, type b) { return (a & 0xFFFFFFFFu) * (b & 0xFFFFFFFFu); }
+    static type bxor(type a, type b) { return a ^ b; }
+    static type band(type a, type b) { return a & b; }
+    static type bor(type a, type b) { return a | b; }
+    template<int k> static type shl(type x) { return x << k; }
+    template<int k> static type shr(type x) { return x >> k; }
+    template<int k> static type rotl(type x) { return (x << k) | (x >> (64 - k)); }
+};
+
+#ifdef BOOST_RANDOM_HAS_SSE2
+struct simd_u64_sse2
+{
+    typedef __m128i type;
+    static const std::size_t width = 2;
+
+    static type load(const std::uint64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(std::uint64_t* p, type x) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x); }
+    static type set1(std::uint64_t x) { return _mm_set1_epi64x(static_cast<long long>(x)); }
+    static type add(type a, type b) { return _mm_add_epi64(a, b); }
+    static type sub(type a, type b) { return _mm_sub_epi64(a, b); }
+    static type mul32(type a, type b) { return _mm_mul_epu32(a, b); }
+    static type bxor(type a, type b) { return _mm_xor_si128(a, b); }
+    static type band(type a, type b) { return _mm_and_si128(a, b); }
+    static type bor(type a, type b) { return _mm_or_si128(a, b); }
+    template<int k> static type shl(type x) { return _mm_slli_epi64(x, k); }
+    template<int k> static type shr(type x) { return _mm_srli_epi64(x, k); }
+    template<int k> static type rotl(type x) { return _mm_or_si128(_mm_slli_epi64(x, k), _mm_srli_epi64(x, 64 - k)); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX2
+struct simd_u64_avx2
+{
+    typedef __m256i type;
+    static const std::size_t width = 4;
+
+    static type load(const std::uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(std::uint64_t* p, type x) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); }
+    static type set1(std::uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+    static type add(type a, type b) { return _mm256_add_epi64(a, b); }
+    static type sub(type a, type b) { return _mm256_sub_epi64(a, b); }
+    static type mul32(type a, type b) { return _mm256_mul_epu32(a, b); }
+    static type bxor(type a, type b) { return _mm256_xor_si256(a, b); }
+    static type band(type a, type b) { return _mm256_and_si256(a, b); }
+    static type bor(type a, type b) { return _mm256_or_si256(a, b); }
+    template<int k> static type shl(type x) { return _mm256_slli_epi64(x, k); }
+    template<int k> static type shr(type x) { return _mm256_srli_epi64(x, k); }
+    template<int k> static type rotl(type x) { return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k)); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX512
+struct simd_u64_avx512
+{
+    typedef __m512i type;
+    static const std::size_t width = 8;
+
+    static type load(const std::uint64_t* p) { return _mm512_loadu_si512(p); }
+    static void store(std::uint64_t* p, type x) { _mm512_storeu_si512(p, x); }
+    static type set1(std::uint64_t x) { return _mm512_set1_epi64(static_cast<long long>(x)); }
+    static type add(type a, type b) { return _mm512_add_epi64(a, b); }
+    static type sub(type a, type b) { return _mm512_sub_epi64(a, b); }
+    static type mul32(type a, type b) { return _mm512_mul_epu32(a, b); }
+    static type bxor(type a, type b) { return _mm512_xor_si512(a, b); }
+    static type band(type a, type b) { return _mm512_and_si512(a, b); }
+    static type bor(type a, type b) { return _mm512_or_si512(a, b); }
+    template<int k> static type shl(type x) { return _mm512_slli_epi64(x, k); }
+    template<int k> static type shr(type x) { return _mm512_srli_epi64(x, k); }
+    template<int k> static type rotl(type x) { return _mm512_rol_epi64(x, k); }
+};
+#endif
+
+struct simd_u32_scalar
+{
+    typedef std::uint32_t type;
+    static const std::size_t width = 1;
+
+    static type load(const std::uint32_t* p) { return *p; }
+    static void store(std::uint32_t* p, type x) { *p = x; }
+    static type set1(std::uint32_t x) { return x; }
+    static type add(type a, type b) { return a + b; }
+    static type sub(type a, type b) { return a - b; }
+    static type bxor(type a, type b) { return a ^ b; }
+    static type band(type a, type b) { return a & b; }
+    static type bor(type a, type b) { return a | b; }
+    template<int k> static type shl(type x) { return x << k; }
+    template<int k> static type shr(type x) { return x >> k; }
+    template<int k> static type rotl(type x) { return (x << k) | (x >> (32 - k)); }
+};
+
+#ifdef BOOST_RANDOM_HAS_SSE2
+struct simd_u32_sse2
+{
+    typedef __m128i type;
+    static const std::size_t width = 4;
+
+    static type load(const std::uint32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(std::uint32_t* p, type x) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x); }
+    static type set1(std::uint32_t x) { return _mm_set1_epi32(static_cast<int>(x)); }
+    static type add(type a, type b) { return _mm_add_epi32(a, b); }
+    static type sub(type a, type b) { return _mm_sub_epi32(a, b); }
+    static type bxor(type a, type b) { return _mm_xor_si128(a, b); }
+    static type band(type a, type b) { return _mm_and_si128(a, b); }
+    static type bor(type a, type b) { return _mm_or_si128(a, b); }
+    template<int k> static type shl(type x) { return _mm_slli_epi32(x, k); }
+    template<int k> static type shr(type x) { return _mm_srli_epi32(x, k); }
+    template<int k> static type rotl(type x) { return rotl(x, std::integral_constant<int, k>()); }
+
+private:
+    template<int k> static type rotl(type x, std::integral_constant<int, k>) { return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k)); }
+    // swapping the 16-bit halves of each lane needs a single shuffle per half
+    static type rotl(type x, std::integral_constant<int, 16>) { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xB1), 0xB1); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX2
+struct simd_u32_avx2
+{
+    typedef __m256i type;
+    static const std::size_t width = 8;
+
+    static type load(const std::uint32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(std::uint32_t* p, type x) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); }
+    static type set1(std::uint32_t x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+    static type add(type a, type b) { return _mm256_add_epi32(a, b); }
+    static type sub(type a, type b) { return _mm256_sub_epi32(a, b); }
+    static type bxor(type a, type b) { return _mm256_xor_si256(a, b); }
+    static type band(type a, type b) { return _mm256_and_si256(a, b); }
+    static type bor(type a, type b) { return _mm256_or_si256(a, b); }
+    template<int k> static type shl(type x) { return _mm256_slli_epi32(x, k); }
+    template<int k> static type shr(type x) { return _mm256_srli_epi32(x, k); }
+    template<int k> static type rotl(type x) { return rotl(x, std::integral_constant<int, k>()); }
+
+private:
+    template<int k> static type rotl(type x, std::integral_constant<int, k>) { return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k)); }
+    // rotations by whole bytes are a single byte shuffle
+    static type rotl(type x, std::integral_constant<int, 8>)
+    { return _mm256_shuffle_epi8(x, _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+                                                    14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3)); }
+    static type rotl(type x, std::integral_constant<int, 16>)
+    { return _mm256_shuffle_epi8(x, _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                                                    13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2)); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX512
+struct simd_u32_avx512
+{
+    typedef __m512i type;
+    static const std::size_t width = 16;
+
+    static type load(const std::uint32_t* p) { return _mm512_loadu_si512(p); }
+    static void store(std::uint32_t* p, type x) { _mm512_storeu_si512(p, x); }
+    static type set1(std::uint32_t x) { return _mm512_set1_epi32(static_cast<int>(x)); }
+    static type add(type a, type b) { return _mm512_add_epi32(a, b); }
+    static type sub(type a, type b) { return _mm512_sub_epi32(a, b); }
+    static type bxor(type a, type b) { return _mm512_xor_si512(a, b); }
+    static type band(type a, type b) { return _mm512_and_si512(a, b); }
+    static type bor(type a, type b) { return _mm512_or_si512(a, b); }
+    template<int k> static type shl(type x) { return _mm512_slli_epi32(x, k); }
+    template<int k> static type shr(type x) { return _mm512_srli_epi32(x, k); }
+    template<int k> static type rotl(type x) { return _mm512_rol_epi32(x, k); }
+};
+#endif
+
+// Double precision lanes, for the floating point engines whose state
+// holds exact multiples of 2^-w.  sub_if_ge(a, b) is a - b in the lanes
+// where a >= b and a elsewhere.
+#ifdef BOOST_RANDOM_HAS_SSE2
+struct simd_f64_sse2
+{
+    typedef __m128d type;
+    static const std::size_t width = 2;
+
+    static type load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, type x) { _mm_storeu_pd(p, x); }
+    static type set1(double x) { return _mm_set1_pd(x); }
+    static type add(type a, type b) { return _mm_add_pd(a, b); }
+    static type sub(type a, type b) { return _mm_sub_pd(a, b); }
+    static type sub_if_ge(type a, type b) { return _mm_sub_pd(a, _mm_and_pd(_mm_cmpge_pd(a, b), b)); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX2
+struct simd_f64_avx2
+{
+    typedef __m256d type;
+    static const std::size_t width = 4;
+
+    static type load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, type x) { _mm256_storeu_pd(p, x); }
+    static type set1(double x) { return _mm256_set1_pd(x); }
+    static type add(type a, type b) { return _mm256_add_pd(a, b); }
+    static type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+    static type sub_if_ge(type a, type b) { return _mm256_sub_pd(a, _mm256_and_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ), b)); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX512
+struct simd_f64_avx512
+{
+    typedef __m512d type;
+    static const std::size_t width = 8;
+
+    static type load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, type x) { _mm512_storeu_pd(p, x); }
+    static type set1(double x) { return _mm512_set1_pd(x); }
+    static type add(type a, type b) { return _mm512_add_pd(a, b); }
+    static type sub(type a, type b) { return _mm512_sub_pd(a, b); }
+    static type sub_if_ge(type a, type b) { return _mm512_mask_sub_pd(a, _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ), a, b); }
+};
+#endif
+
+#ifdef BOOST_RANDOM_HAS_AVX512_DISPATCH
+// Whether the processor running the program supports AVX-512F, for
+// kernels marked BOOST_RANDOM_TARGET_AVX512.
+inline bool cpu_has_avx512f()
+{
+#ifdef BOOST_RANDOM_HAS_AVX512
+    return true;
+#else
+    static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("avx512f") != 0);
+    return result;
+#endif
+}
+#endif
+
+// Marks the absence of a usable vector type.
+struct simd_none {};
+
+// The widest vector of T available in this translation unit, or
+// simd_none if there is none (or T is not std::uint32_t/std::uint64_t).
+template<class T>
+struct simd_select_word
+{
+    typedef simd_none type;
+};
+
+template<>
+struct simd_select_word<std::uint32_t>
+{
+#if defined(BOOST_RANDOM_HAS_AVX512)
+    typedef simd_u32_avx512 type;
+#elif defined(BOOST_RANDOM_HAS_AVX2)
+    typedef simd_u32_avx2 type;
+#elif defined(BOOST_RANDOM_HAS_SSE2)
+    typedef simd_u32_sse2 type;
+#else
+    typedef simd_none type;
+#endif
+};
+
+template<>
+struct simd_select_word<std::uint64_t>
+{
+#if defined(BOOST_RANDOM_HAS_AVX512)
+    typedef simd_u64_avx512 type;
+#elif defined(BOOST_RANDOM_HAS_AVX2)
+    typedef simd_u64_avx2 type;
+#elif defined(BOOST_RANDOM_HAS_SSE2)
+    typedef simd_u64_sse2 type;
+#else
+    typedef simd_none type;
+#endif
+};
+
+// The widest vector of the floating point type T available in this
+// translation unit, or simd_none.
+template<class T>
+struct simd_select_real
+{
+    typedef simd_none type;
+};
+
+template<>
+struct simd_select_real<double>
+{
+#if defined(BOOST_RANDOM_HAS_AVX512)
+    typedef simd_f64_avx512 type;
+#elif defined(BOOST_RANDOM_HAS_AVX2)
+    typedef simd_f64_avx2 type;
+#elif defined(BOOST_RANDOM_HAS_SSE2)
+    typedef simd_f64_sse2 type;
+#else
+    typedef simd_none type;
+#endif
+};
+
+// Selects the widest 64-bit lane vector whose width divides Lanes.
+template<std::size_t Lanes>
+struct simd_u64_select
+{
+#if defined(BOOST_RANDOM_HAS_AVX512)
+    typedef typename std::conditional<Lanes % 8 == 0, simd_u64_avx512,
+            typename std::conditional<Lanes % 4 == 0, simd_u64_avx2,
+            typename std::conditional<Lanes % 2 == 0, simd_u64_sse2, simd_u64_scalar>::type>::type>::type type;
+#elif defined(BOOST_RANDOM_HAS_AVX2)
+    typedef typename std::conditional<Lanes % 4 == 0, simd_u64_avx2,
+            typename std::conditional<Lanes % 2 == 0, simd_u64_sse2, simd_u64_scalar>::type>::type type;
+#elif defined(BOOST_RANDOM_HAS_SSE2)
+    typedef typename std::conditional<Lanes % 2 == 0, simd_u64_sse2, simd_u64_scalar>::type type;
+#else
+    typedef simd_u64_scalar type;
+#endif
+};
+
+} // namespace detail
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_DETAIL_SIMD_HPP
@@ -0,0 +1,300 @@
+/* boost random/detail/subtract_with_carry_lcg.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_DETAIL_SUBTRACT_WITH_CARRY_LCG_HPP
+#define BOOST_RANDOM_DETAIL_SUBTRACT_WITH_CARRY_LCG_HPP
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/random/detail/large_arithmetic.hpp>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// The subtract with borrow recurrence
+//
+//   x(n) = x(n-s) - x(n-r) - c(n-1) (mod b),  b = 2^w
+//
+// is equivalent to the linear congruential generator y(n+1) = a * y(n)
+// mod m with m = b^r - b^s + 1 and a = b^-1 mod m (Marsaglia and Zaman
+// 1991, Tezuka, L'Ecuyer and Couture 1993).  With the window read as
+// the integer R = x(n-r) + x(n-r+1) b + ... + x(n-1) b^(r-1),
+//
+//   y(n) = R - floor(R / b^(r-s)) + c(n-1) (mod m)
+//
+// and the newest element of the window is x(n-1) = floor(b y(n) / m).
+// Only x(n-r) + c(n-1) can be recovered from y(n) itself, so the oldest
+// element is read from y(n-r+1) = b^(r-1) y(n) instead.  This gives the
+// exact window and borrow as long as y(n-r+1) is a state the generator
+// has actually passed through, that is, for jumps of at least r.
+//
+// The two fixed points, all zero with no borrow and all b-1 with a
+// borrow, both map to y = 0.  Callers check for that case.
+class subtract_with_carry_lcg
+{
+public:
+    typedef boost::uint64_t limb_t;
+    typedef std::vector<limb_t> number;
+
+    subtract_with_carry_lcg(std::size_t w, std::size_t s, std::size_t r)
+      : _w(w), _s(s), _r(r), _size((w * r) / 64 + 2)
+    {
+        // m = 2^(wr) - 2^(ws) + 1
+        _m = power_of_two(w * r);
+        sub(_m, power_of_two(w * s));
+        add_small(_m, 1);
+    }
+
+    /** Returns y(n) for the window digits[0, r) (oldest first) and borrow c. */
+    number from_state(const limb_t* digits, unsigned c) const
+    {
+        number y(_size);
+        for(std::size_t j = _r; j-- > 0; ) {
+            shl_inplace(y, _w);
+            y[0] |= digits[j];
+        }
+        sub(y, shr(y, _w * (_r - _s)));
+        add_small(y, c);
+        if(!less(y, _m)) {
+            sub(y, _m);
+        }
+        return y;
+    }
+
+    /**
+     * Inverse of from_state for states the generator has passed
+     * through at least r steps ago.  Returns the borrow.
+     */
+    unsigned to_state(const number& y, limb_t* digits) const
+    {
+        number t = y;
+        for(std::size_t j = _r; j-- > 0; ) {
+            digits[j] = next_digit(t);
+        }
+        // c = y - (R - floor(R / b^(r-s))) (mod m)
+        number z(_size);
+        for(std::size_t j = _r; j-- > 0; ) {
+            shl_inplace(z, _w);
+            z[0] |= digits[j];
+        }
+        sub(z, shr(z, _w * (_r - _s)));
+        number c = y;
+        if(less(c, z)) {
+            add(c, _m);
+        }
+        sub(c, z);
+        BOOST_ASSERT(c[0] <= 1);
+        return static_cast<unsigned>(c[0]);
+    }
+
+    /** Returns y * a^z mod m, which is the state z steps after y. */
+    number advance(const number& y, boost::uintmax_t z) const
+    {
+        // a = b^-1 = m - (m - 1) / b
+        number t = _m;
+        sub(t, one());
+        number a = _m;
+        sub(a, shr(t, _w));
+
+        number result = y;
+        number base = a;
+        while(z != 0) {
+            if(z & 1u) {
+                result = mulmod(result, base);
+            }
+            z >>= 1;
+            if(z != 0) {
+                base = mulmod(base, base);
+            }
+        }
+        return result;
+    }
+
+    static bool is_zero(const number& y)
+    {
+        for(std::size_t i = 0; i < y.size(); ++i) {
+            if(y[i] != 0) return false;
+        }
+        return true;
+    }
+
+private:
+    number one() const
+    {
+        number result(_size);
+        result[0] = 1;
+        return result;
+    }
+
+    number power_of_two(std::size_t bits) const
+    {
+        number result(_size);
+        result[bits / 64] = limb_t(1) << (bits % 64);
+        return result;
+    }
+
+    // x(n-1) = floor(b y / m), y <- b y mod m
+    limb_t next_digit(number& y) const
+    {
+        // m < 2^(wr), so the quotient is floor(b y / 2^(wr)) or one more
+        shl_inplace(y, _w);
+        number q = shr(y, _w * _r);
+        low_inplace(y, _w * _r);
+        number qm = q;
+        shl_inplace(qm, _w * _s);
+        add(y, qm);
+        sub(y, q);
+        limb_t digit = q[0];
+        if(!less(y, _m)) {
+            sub(y, _m);
+            ++digit;
+        }
+        return digit;
+    }
+
+    number mulmod(const number& lhs, const number& rhs) const
+    {
+        number p(2 * _size);
+        for(std::size_t i = 0; i < _size; ++i) {
+            if(lhs[i] == 0) continue;
+            limb_t carry = 0;
+            for(std::size_t j = 0; j < _size; ++j) {
+                limb_t hi;
+                limb_t lo = umul128(lhs[i], rhs[j], hi);
+                lo += carry;
+                hi += (lo < carry);
+                limb_t sum = p[i + j] + lo;
+                hi += (sum < lo);
+                p[i + j] = sum;
+                carry = hi;
+            }
+            p[i + _size] += carry;
+        }
+        // fold 2^(wr) = 2^(ws) - 1 until the value fits in wr bits
+        for(;;) {
+            number h = shr(p, _w * _r);
+            if(is_zero(h)) break;
+            low_inplace(p, _w * _r);
+            number hs = h;
+            shl_inplace(hs, _w * _s);
+            add(p, hs);
+            sub(p, h);
+        }
+        p.resize(_size);
+        if(!less(p, _m)) {
+            sub(p, _m);
+        }
+        return p;
+    }
+
+    static void add(number& lhs, const number& rhs)
+    {
+        limb_t carry = 0;
+        for(std::size_t i = 0; i < lhs.size(); ++i) {
+            const limb_t r_i = i < rhs.size() ? rhs[i] : 0;
+            const limb_t sum = lhs[i] + r_i;
+            const limb_t c1 = (sum < r_i);
+            lhs[i] = sum + carry;
+            carry = c1 | (lhs[i] < carry);
+        }
+    }
+
+    static void add_small(number& lhs, limb_t value)
+    {
+        for(std::size_t i = 0; i < lhs.size() && value != 0; ++i) {
+            lhs[i] += value;
+            value = (lhs[i] < value);
+        }
+    }
+
+    // lhs -= rhs, requires lhs >= rhs
+    static void sub(number& lhs, const number& rhs)
+    {
+        limb_t borrow = 0;
+        for(std::size_t i = 0; i < lhs.size(); ++i) {
+            const limb_t r_i = i < rhs.size() ? rhs[i] : 0;
+            const limb_t diff = lhs[i] - r_i;
+            const limb_t b1 = (lhs[i] < r_i);
+            lhs[i] = diff - borrow;
+            borrow = b1 | (diff < borrow);
+        }
+    }
+
+    static bool less(const number& lhs, const number& rhs)
+    {
+        const std::size_t n = lhs.size() > rhs.size() ? lhs.size() : rhs.size();
+        for(std::size_t i = n; i-- > 0; ) {
+            const limb_t l = i < lhs.size() ? lhs[i] : 0;
+            const limb_t r = i < rhs.size() ? rhs[i] : 0;
+            if(l != r) return l < r;
+        }
+        return false;
+    }
+
+    static number shr(const number& x, std::size_t bits)
+    {
+        number result(x.size());
+        const std::size_t limbs = bits / 64;
+        const unsigned shift = static_cast<unsigned>(bits % 64);
+        for(std::size_t i = 0; i + limbs < x.size(); ++i) {
+            limb_t v = x[i + limbs] >> shift;
+            if(shift != 0 && i + limbs + 1 < x.size()) {
+                v |= x[i + limbs + 1] << (64 - shift);
+            }
+            result[i] = v;
+        }
+        return result;
+    }
+
+    static void shl_inplace(number& x, std::size_t bits)
+    {
+        const std::size_t limbs = bits / 64;
+        const unsigned shift = static_cast<unsigned>(bits % 64);
+        for(std::size_t i = x.size(); i-- > 0; ) {
+            limb_t v = 0;
+            if(i >= limbs) {
+                v = x[i - limbs] << shift;
+                if(shift != 0 && i >= limbs + 1) {
+                    v |= x[i - limbs - 1] >> (64 - shift);
+                }
+            }
+            x[i] = v;
+        }
+    }
+
+    static void low_inplace(number& x, std::size_t bits)
+    {
+        for(std::size_t i = 0; i < x.size(); ++i) {
+            if(i * 64 >= bits) {
+                x[i] = 0;
+            } else if((i + 1) * 64 > bits) {
+                x[i] &= (limb_t(1) << (bits % 64)) - 1;
+            }
+        }
+    }
+
+    std::size_t _w;
+    std::size_t _s;
+    std::size_t _r;
+    std::size_t _size;
+    number _m;
+};
+
+} // namespace detail
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_DETAIL_SUBTRACT_WITH_CARRY_LCG_HPP
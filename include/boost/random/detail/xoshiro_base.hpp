@@ -14,6 +14,7 @@
 
 #include <boost/random/splitmix64.hpp>
 #include <boost/random/detail/seed.hpp>
+#include <boost/random/detail/polynomial.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/config.hpp>
 #include <array>
@@ -251,6 +252,58 @@ private:
         state_[3] = s3;
     }
 
+    static constexpr std::size_t state_bits = N * std::numeric_limits<BlockType>::digits;
+
+    // The transition function is linear over GF(2) and has a primitive
+    // characteristic polynomial, so the minimal polynomial of any single
+    // state bit is the characteristic polynomial.  It depends only on
+    // the generator, so it is computed once.
+    static const detail::polynomial& characteristic_polynomial()
+    {
+        static const detail::polynomial phi = compute_characteristic_polynomial();
+        return phi;
+    }
+
+    static detail::polynomial compute_characteristic_polynomial()
+    {
+        Derived tmp;
+        xoshiro_base& gen = tmp;
+        detail::polynomial seq;
+        for (std::size_t i = 0; i < 2 * state_bits; ++i)
+        {
+            seq[i] = (gen.state_[0] & 1U) != 0;
+            gen.next();
+        }
+
+        return detail::minimal_polynomial(seq, 2 * state_bits);
+    }
+
+    /**
+     * Jumps ahead by z steps in O(log z) time, using the same approach
+     * as jump(): g(t) = t^z mod phi(t) is computed, and the new state is
+     * \sum_i g_i T^i(s), where T is the transition function.
+     */
+    void discard_many(const std::uint64_t z)
+    {
+        const detail::polynomial g = detail::mod_pow_x(z, characteristic_polynomial());
+
+        std::array<BlockType, N> t {};
+        for (std::size_t i = 0; i < state_bits; ++i)
+        {
+            if (g[i])
+            {
+                for (std::size_t w = 0; w < N; ++w)
+                {
+                    t[w] ^= state_[w];
+                }
+            }
+
+            next();
+        }
+
+        state_ = t;
+    }
+
 public:
 
     using result_type = OutputType;
@@ -376,12 +429,26 @@ public:
         return next();
     }
 
-    /** Advances the state of the generator by @c z. */
-    inline void discard(const std::uint64_t z) noexcept
+    /**
+     * Advances the state of the generator by @c z.  Large distances are
+     * handled by a polynomial jump-ahead in O(log z) time, which works
+     * on heap-allocated polynomials and so may throw @c std::bad_alloc.
+     */
+    inline void discard(const std::uint64_t z)
     {
-        for (std::uint64_t i {}; i < z; ++i)
+#ifndef BOOST_RANDOM_XOSHIRO_DISCARD_THRESHOLD
+#define BOOST_RANDOM_XOSHIRO_DISCARD_THRESHOLD 100000
+#endif
+        if (z > BOOST_RANDOM_XOSHIRO_DISCARD_THRESHOLD)
         {
-            next();
+            discard_many(z);
+        }
+        else
+        {
+            for (std::uint64_t i {}; i < z; ++i)
+            {
+                next();
+            }
         }
     }
 
@@ -30,6 +30,26 @@
 namespace boost {
 namespace random {
 
+namespace detail {
+
+// Presents the values of a discard_block_engine to detail::generate,
+// skipping the discarded part of each block with a single call to the
+// underlying generator's discard().
+template<class Engine>
+struct discard_block_kept
+{
+    typedef typename Engine::result_type result_type;
+    explicit discard_block_kept(Engine& e) : eng(e) {}
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (Engine::min)(); }
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (Engine::max)(); }
+    result_type operator()() { return eng.next_kept(); }
+    Engine& eng;
+};
+
+}
+
 /**
  * The class template \discard_block_engine is a model of
  * \pseudo_random_number_generator.  It modifies
@@ -121,16 +141,45 @@ public:
         return _rng();
     }
 
+    /**
+     * Advances the state of the generator by @c z.  The underlying
+     * generator is advanced with a few calls to its own @c discard(),
+     * so this is as fast as the underlying generator's @c discard().
+     */
     void discard(boost::uintmax_t z)
     {
-        for(boost::uintmax_t j = 0; j < z; ++j) {
-            (*this)();
+        if(z <= returned_block - _n) {
+            _rng.discard(z);
+            _n += static_cast<std::size_t>(z);
+            return;
         }
+        // finish the current block, then skip whole blocks
+        _rng.discard(returned_block - _n);
+        z -= returned_block - _n;
+        boost::uintmax_t blocks = (z - 1) / returned_block;
+        const std::size_t last = static_cast<std::size_t>(z - blocks * returned_block);
+        const boost::uintmax_t max_blocks =
+            (std::numeric_limits<boost::uintmax_t>::max)() / total_block;
+        for(; blocks > max_blocks; blocks -= max_blocks) {
+            _rng.discard(max_blocks * total_block);
+        }
+        _rng.discard(blocks * total_block);
+        _rng.discard(total_block - returned_block + last);
+        _n = last;
     }
 
+    /**
+     * Fills a range with random values.  The discarded part of each
+     * block is skipped in bulk by the underlying generator's
+     * @c discard(), and only the kept values are converted and
+     * written to the range.
+     */
     template<class It>
     void generate(It first, It last)
-    { detail::generate(*this, first, last); }
+    {
+        detail::discard_block_kept<discard_block_engine> kept(*this);
+        detail::generate(kept, first, last);
+    }
 
     /**
      * Returns the smallest value that the generator can produce.
@@ -176,6 +225,21 @@ public:
     { return !(x == y); }
 
 private:
+    /// \cond show_private
+    friend struct detail::discard_block_kept<discard_block_engine>;
+
+    // operator() with the discarded values skipped by _rng.discard()
+    result_type next_kept()
+    {
+        if(_n >= returned_block) {
+            _rng.discard(total_block - _n);
+            _n = 0;
+        }
+        ++_n;
+        return _rng();
+    }
+    /// \endcond
+
     base_type _rng;
     std::size_t _n;
 };
@@ -227,6 +291,11 @@ namespace detail {
         static std::size_t value() { return generator_bits<URNG>::value(); }
     };
 
+    template<class Engine>
+    struct generator_bits<discard_block_kept<Engine> > {
+        static std::size_t value() { return generator_bits<Engine>::value(); }
+    };
+
     template<class URNG, int p, int r>
     struct generator_bits<discard_block<URNG, p, r> > {
         static std::size_t value() { return generator_bits<URNG>::value(); }
@@ -0,0 +1,148 @@
+/* boost random/hash_seed_seq.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_HASH_SEED_SEQ_HPP
+#define BOOST_RANDOM_HASH_SEED_SEQ_HPP
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace random {
+
+/**
+ * The class @c hash_seed_seq stores a sequence of 32-bit words for
+ * seeding a \pseudo_random_number_generator, like @c seed_seq, and can
+ * be used wherever a @c seed_seq is.  It fills the state of the
+ * generator differently, by hashing instead of with the algorithm
+ * that the standard specifies.
+ *
+ * The constructor hashes the words into four independent 64-bit
+ * lanes.  Every lane depends on every bit of every word and on the
+ * length of the sequence.  @c generate() then writes each pair of
+ * output words as the SplitMix64 finalizer of a lane plus a counter:
+ *
+ *  @blockquote
+ *  "Fast splittable pseudorandom number generators", Guy L. Steele Jr.,
+ *  Doug Lea and Christine H. Flood, OOPSLA 2014.
+ *  @endblockquote
+ *
+ * So a change to any bit of the input changes about half of the bits
+ * of every output word, even for large outputs, and sequences that
+ * differ only in a task number give unrelated states.  Each output
+ * word is computed on its own in a single pass, which is several times
+ * faster than @c seed_seq and lets the compiler vectorize the loop.
+ *
+ * The output is not the one that the standard specifies for seed_seq,
+ * so the same words seed a generator differently through the two
+ * classes.
+ */
+class hash_seed_seq {
+public:
+    typedef boost::uint_least32_t result_type;
+
+    /** Initializes a hash_seed_seq to hold an empty sequence. */
+    hash_seed_seq() { init(); }
+#ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
+    /** Initializes the sequence from an initializer_list. */
+    template<class T>
+    hash_seed_seq(const std::initializer_list<T>& il) : v(il.begin(), il.end()) { init(); }
+#endif
+    /** Initializes the sequence from an iterator range. */
+    template<class Iter>
+    hash_seed_seq(Iter first, Iter last) : v(first, last) { init(); }
+    /** Initializes the sequence from Boost.Range range. */
+    template<class Range>
+    explicit hash_seed_seq(const Range& range)
+      : v(std::begin(range), std::end(range)) { init(); }
+
+    /**
+     * Fills a range with 32-bit values based on the stored sequence.
+     *
+     * Requires: Iter must be a Random Access Iterator whose value type
+     * is an unsigned integral type at least 32 bits wide.
+     */
+    template<class Iter>
+    void generate(Iter first, Iter last) const
+    {
+        typedef typename std::iterator_traits<Iter>::value_type value_type;
+        std::size_t n = last - first;
+        // Groups of eight words use the four lanes with the same
+        // counter, so the inner loop has no dependencies.
+        std::size_t groups = n / 8;
+        for(std::size_t g = 0; g < groups; ++g) {
+            boost::uint64_t ctr = (g + 1) * golden;
+            for(std::size_t j = 0; j < 4; ++j) {
+                boost::uint64_t h = mix(key[j] + ctr);
+                *(first + (8*g + 2*j)) = static_cast<value_type>(h & 0xffffffffu);
+                *(first + (8*g + 2*j + 1)) = static_cast<value_type>(h >> 32);
+            }
+        }
+        for(std::size_t k = 8*groups; k < n; ++k) {
+            boost::uint64_t h = mix(key[(k / 2) % 4] + (groups + 1) * golden);
+            *(first + k) = static_cast<value_type>((k % 2 == 0) ? (h & 0xffffffffu) : (h >> 32));
+        }
+    }
+    /** Returns the size of the sequence. */
+    std::size_t size() const { return v.size(); }
+    /** Writes the stored sequence to iter. */
+    template<class Iter>
+    void param(Iter out) const { std::copy(v.begin(), v.end(), out); }
+private:
+    /// \cond show_private
+    static const boost::uint64_t golden = 0x9e3779b97f4a7c15ull;
+
+    // The SplitMix64 finalizer, a bijection with full avalanche.
+    static boost::uint64_t mix(boost::uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // Each lane starts from its own constant (the fractional digits
+    // of pi) and absorbs every word and then the length.
+    void init()
+    {
+        key[0] = 0x243f6a8885a308d3ull;
+        key[1] = 0x13198a2e03707344ull;
+        key[2] = 0xa4093822299f31d0ull;
+        key[3] = 0x082efa98ec4e6c89ull;
+        for(std::size_t i = 0; i < v.size(); ++i) {
+            boost::uint64_t x = (v[i] & 0xffffffffu) + golden;
+            for(std::size_t j = 0; j < 4; ++j) {
+                key[j] = mix(key[j] ^ x);
+            }
+        }
+        for(std::size_t j = 0; j < 4; ++j) {
+            key[j] = mix(key[j] ^ v.size());
+        }
+    }
+
+    std::vector<result_type> v;
+    boost::uint64_t key[4];
+    /// \endcond
+};
+
+}
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include <boost/cstdint.hpp>
 #include <boost/random/detail/config.hpp>
 #include <boost/random/detail/const_mod.hpp>
+#include <boost/random/detail/inversive_congruential_jump.hpp>
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/operators.hpp>
 #include <boost/random/detail/seed_impl.hpp>
@@ -32,6 +33,37 @@
 namespace boost {
 namespace random {
 
+namespace detail {
+
+// Presents the values of an inversive_congruential_engine to
+// detail::generate, computing them a block at a time.
+template<class Engine>
+struct inversive_congruential_block
+{
+    typedef typename Engine::result_type result_type;
+    BOOST_STATIC_CONSTANT(std::size_t, block_size = 32);
+    explicit inversive_congruential_block(Engine& e) : eng(e), pos(0) {}
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (Engine::min)(); }
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (Engine::max)(); }
+    result_type operator()()
+    {
+        if(pos == 0) {
+            eng.next_block(values, block_size);
+        }
+        // the engine is left at the last value actually used
+        eng._value = values[pos];
+        pos = (pos + 1) % block_size;
+        return eng._value;
+    }
+    Engine& eng;
+    std::size_t pos;
+    result_type values[block_size];
+};
+
+}
+
 // Eichenauer and Lehn 1986
 /**
  * Instantiations of class template @c inversive_congruential_engine model a
@@ -165,16 +197,36 @@ public:
         return _value;
     }
   
-    /** Fills a range with random values */
+    /**
+     * Fills a range with random values.  The values are computed in
+     * blocks that share a single modular inversion.
+     */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        detail::inversive_congruential_block<inversive_congruential_engine> block(*this);
+        detail::generate_from_int(block, first, last);
+    }
 
-    /** Advances the state of the generator by @c z. */
+    /**
+     * Advances the state of the generator by @c z.  For prime moduli
+     * below 2^32, large jumps take time polylogarithmic in @c z.
+     */
     void discard(boost::uintmax_t z)
     {
-        for(boost::uintmax_t j = 0; j < z; ++j) {
-            (*this)();
+#ifndef BOOST_RANDOM_INVERSIVE_CONGRUENTIAL_DISCARD_THRESHOLD
+#define BOOST_RANDOM_INVERSIVE_CONGRUENTIAL_DISCARD_THRESHOLD 10000
+#endif
+        if(z > BOOST_RANDOM_INVERSIVE_CONGRUENTIAL_DISCARD_THRESHOLD &&
+           a > 0 && b >= 0 && p > 0 &&
+           detail::inversive_congruential_jump::supported(a, p)) {
+            boost::uint64_t x = static_cast<boost::uint64_t>(_value);
+            detail::inversive_congruential_jump(a, b, p).advance(x, z);
+            _value = static_cast<IntType>(x);
+        } else {
+            for(boost::uintmax_t j = 0; j < z; ++j) {
+                (*this)();
+            }
         }
     }
 
@@ -210,6 +262,48 @@ public:
     BOOST_RANDOM_DETAIL_INEQUALITY_OPERATOR(inversive_congruential_engine)
 
 private:
+    /// \cond show_private
+    friend struct detail::inversive_congruential_block<inversive_congruential_engine>;
+
+    // Writes the next n values to out without changing the state.
+    // With x = X/Z the step is (X : Z) -> (a Z + b X : X), so the
+    // values are computed without inversions and the n denominators
+    // are then inverted together (Montgomery's trick).
+    void next_block(IntType* out, std::size_t n) const
+    {
+        typedef const_mod<IntType, p> do_mod;
+        const std::size_t block_size =
+            detail::inversive_congruential_block<inversive_congruential_engine>::block_size;
+        BOOST_ASSERT(n <= block_size);
+        IntType num[block_size];
+        IntType den[block_size];
+        IntType prefix[block_size];
+        IntType x = _value;
+        IntType z = 1;
+        IntType acc = 1;
+        for(std::size_t i = 0; i < n; ++i) {
+            if(x == 0) {
+                // inv(0) = 0, so 0 goes to b
+                x = b;
+                z = 1;
+            } else {
+                const IntType next = do_mod::add(do_mod::mult(a, z), do_mod::mult(b, x));
+                z = x;
+                x = next;
+            }
+            num[i] = x;
+            den[i] = z;
+            prefix[i] = acc;
+            acc = do_mod::mult(acc, z);
+        }
+        IntType inv = do_mod::invert(acc);
+        for(std::size_t i = n; i-- > 0; ) {
+            out[i] = do_mod::mult(num[i], do_mod::mult(inv, prefix[i]));
+            inv = do_mod::mult(inv, den[i]);
+        }
+    }
+    /// \endcond
+
     IntType _value;
 };
 
@@ -21,6 +21,7 @@
 #include <iosfwd>
 #include <algorithm>     // std::max
 #include <iterator>
+#include <vector>
 #include <boost/config/no_tr1/cmath.hpp>         // std::pow
 #include <boost/config.hpp>
 #include <boost/limits.hpp>
@@ -32,6 +33,8 @@
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/operators.hpp>
 #include <boost/random/detail/generator_seed_seq.hpp>
+#include <boost/random/detail/lagged_fibonacci_jump.hpp>
+#include <boost/random/detail/simd.hpp>
 
 namespace boost {
 namespace random {
@@ -41,6 +44,12 @@ namespace random {
  * \pseudo_random_number_generator. It uses a lagged Fibonacci
  * algorithm with two lags @c p and @c q:
  * x(i) = x(i-p) + x(i-q) (mod 2<sup>w</sup>) with p > q.
+ *
+ * The state is refilled p values at a time using vector instructions
+ * when available.  Long jumps with @c discard() use the characteristic
+ * polynomial of the recurrence and take O(p<sup>1.59</sup> log z) time,
+ * so a single seeded generator can be split into non-overlapping
+ * substreams, one per thread.
  */
 template<class UIntType, int w, unsigned int p, unsigned int q>
 class lagged_fibonacci_engine
@@ -130,12 +139,36 @@ public:
     void generate(Iter first, Iter last)
     { detail::generate_from_int(*this, first, last); }
 
-    /** Advances the state of the generator by @c z. */
+    /**
+     * Advances the state of the generator by @c z.  Whole blocks of
+     * the state are refilled without reading them, and long jumps use
+     * the characteristic polynomial of the recurrence instead.
+     */
     void discard(boost::uintmax_t z)
     {
-        for(boost::uintmax_t j = 0; j < z; ++j) {
-            (*this)();
+        if(z <= long_lag - i) {
+            i += static_cast<unsigned int>(z);
+            return;
+        }
+        // fills is the number of calls to fill() that z calls to
+        // operator() would make.  The last one is always done by
+        // fill(), so that the jump never exceeds z.
+        z -= long_lag - i;
+        const boost::uintmax_t fills = (z - 1) / long_lag + 1;
+        const boost::uintmax_t skip = (fills - 1) * long_lag;
+#ifndef BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD
+#define BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD 4
+#endif
+        if(w <= 64 && skip >= BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD *
+           detail::lagged_fibonacci_jump::cost(long_lag, skip)) {
+            jump(skip);
+            fill();
+        } else {
+            for(boost::uintmax_t j = 0; j < fills; ++j) {
+                fill();
+            }
         }
+        i = static_cast<unsigned int>(z - skip);
     }
 
     /**
@@ -176,6 +209,45 @@ public:
 private:
     /// \cond show_private
     void fill();
+
+    // The vector type used by fill(), or simd_none.
+    typedef typename detail::simd_select_word<UIntType>::type simd_type;
+
+    /**
+     * Vectorized part of one of the loops in fill().  Updates x[j] for
+     * j in [first, last) in groups of V::width, adding x[src + j - first].
+     * The second loop reads elements short_lag before the ones it writes,
+     * so vectors no wider than short_lag give the same result as the
+     * scalar loop.  Returns the first index that was not updated.
+     */
+    template<class V>
+    unsigned int fill_range(unsigned int first, unsigned int last,
+                            unsigned int src, V)
+    {
+        typedef typename V::type vec;
+        if(V::width > short_lag) {
+            return first;
+        }
+        const vec mask = V::set1(low_bits_mask_t<w>::sig_bits);
+        const unsigned int end = first + (last - first) / V::width * V::width;
+        for(unsigned int j = first; j != end; j += V::width, src += V::width) {
+            V::store(&x[j], V::band(V::add(V::load(&x[j]), V::load(&x[src])), mask));
+        }
+        return end;
+    }
+    unsigned int fill_range(unsigned int first, unsigned int, unsigned int,
+                            detail::simd_none)
+    { return first; }
+
+    /** Replaces the state by the one n values later. */
+    void jump(boost::uintmax_t n)
+    {
+        std::vector<boost::uint64_t> y(x, x + long_lag);
+        detail::lagged_fibonacci_jump::apply(&y[0], long_lag, short_lag, n);
+        for(unsigned int j = 0; j < long_lag; ++j) {
+            x[j] = static_cast<UIntType>(y[j]) & low_bits_mask_t<w>::sig_bits;
+        }
+    }
     /// \endcond
 
     unsigned int i;
@@ -201,10 +273,12 @@ void lagged_fibonacci_engine<UIntType, w, p, q>::fill()
 {
     // two loops to avoid costly modulo operations
     {  // extra scope for MSVC brokenness w.r.t. for scope
-    for(unsigned int j = 0; j < short_lag; ++j)
+    for(unsigned int j = fill_range(0, short_lag, long_lag-short_lag, simd_type());
+        j < short_lag; ++j)
         x[j] = (x[j] + x[j+(long_lag-short_lag)]) & low_bits_mask_t<w>::sig_bits;
     }
-    for(unsigned int j = short_lag; j < long_lag; ++j)
+    for(unsigned int j = fill_range(short_lag, long_lag, 0, simd_type());
+        j < long_lag; ++j)
         x[j] = (x[j] + x[j-short_lag]) & low_bits_mask_t<w>::sig_bits;
     i = 0;
 }
@@ -255,6 +329,10 @@ public:
  * The generator requires considerable amounts of memory for the storage
  * of its state array. For example, \lagged_fibonacci607 requires about
  * 4856 bytes and \lagged_fibonacci44497 requires about 350 KBytes.
+ *
+ * As for \lagged_fibonacci_engine, the state is refilled using vector
+ * instructions when available and long jumps with @c discard() take
+ * O(p<sup>1.59</sup> log z) time.
  */
 template<class RealType, int w, unsigned int p, unsigned int q>
 class lagged_fibonacci_01_engine
@@ -338,12 +416,36 @@ public:
     void generate(Iter first, Iter last)
     { return detail::generate_from_real(*this, first, last); }
 
-    /** Advances the state of the generator by @c z. */
+    /**
+     * Advances the state of the generator by @c z.  Whole blocks of
+     * the state are refilled without reading them, and long jumps use
+     * the characteristic polynomial of the recurrence instead.
+     */
     void discard(boost::uintmax_t z)
     {
-        for(boost::uintmax_t j = 0; j < z; ++j) {
-            (*this)();
+        if(z <= long_lag - i) {
+            i += static_cast<unsigned int>(z);
+            return;
         }
+        // fills is the number of calls to fill() that z calls to
+        // operator() would make.  The last one is always done by
+        // fill(), so that the jump never exceeds z.
+        z -= long_lag - i;
+        const boost::uintmax_t fills = (z - 1) / long_lag + 1;
+        const boost::uintmax_t skip = (fills - 1) * long_lag;
+#ifndef BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD
+#define BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD 4
+#endif
+        if(w <= 64 && skip >= BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD *
+           detail::lagged_fibonacci_jump::cost(long_lag, skip)) {
+            jump(skip);
+            fill();
+        } else {
+            for(boost::uintmax_t j = 0; j < fills; ++j) {
+                fill();
+            }
+        }
+        i = static_cast<unsigned int>(z - skip);
     }
 
     /**
@@ -396,6 +498,52 @@ private:
         using std::pow;
         return pow(RealType(2), word_size);
     }
+
+    // The vector type used by fill(), or simd_none.
+    typedef typename detail::simd_select_real<RealType>::type simd_type;
+
+    /**
+     * Vectorized part of one of the loops in fill(), as for
+     * \lagged_fibonacci_engine.  The state values are multiples of
+     * 2<sup>-w</sup>, so the sums are exact in any order.
+     */
+    template<class V>
+    unsigned int fill_range(unsigned int first, unsigned int last,
+                            unsigned int src, V)
+    {
+        typedef typename V::type vec;
+        if(V::width > short_lag) {
+            return first;
+        }
+        const vec one = V::set1(RealType(1));
+        const unsigned int end = first + (last - first) / V::width * V::width;
+        for(unsigned int j = first; j != end; j += V::width, src += V::width) {
+            V::store(&x[j], V::sub_if_ge(V::add(V::load(&x[j]), V::load(&x[src])), one));
+        }
+        return end;
+    }
+    unsigned int fill_range(unsigned int first, unsigned int, unsigned int,
+                            detail::simd_none)
+    { return first; }
+
+    /**
+     * Replaces the state by the one n values later.  The state is
+     * converted to w-bit integers, which follow the same recurrence
+     * modulo 2<sup>w</sup>.
+     */
+    void jump(boost::uintmax_t n)
+    {
+        const RealType mod = modulus();
+        std::vector<boost::uint64_t> y(long_lag);
+        for(unsigned int j = 0; j < long_lag; ++j) {
+            y[j] = static_cast<boost::uint64_t>(x[j] * mod);
+        }
+        detail::lagged_fibonacci_jump::apply(&y[0], long_lag, short_lag, n);
+        const boost::uint64_t mask = low_bits_mask_t<(w < 64 ? w : 64)>::sig_bits;
+        for(unsigned int j = 0; j < long_lag; ++j) {
+            x[j] = static_cast<RealType>(y[j] & mask) / mod;
+        }
+    }
     /// \endcond
     unsigned int i;
     RealType x[long_lag];
@@ -421,14 +569,16 @@ void lagged_fibonacci_01_engine<RealType, w, p, q>::fill()
 {
     // two loops to avoid costly modulo operations
     {  // extra scope for MSVC brokenness w.r.t. for scope
-    for(unsigned int j = 0; j < short_lag; ++j) {
+    for(unsigned int j = fill_range(0, short_lag, long_lag-short_lag, simd_type());
+        j < short_lag; ++j) {
         RealType t = x[j] + x[j+(long_lag-short_lag)];
         if(t >= RealType(1))
             t -= RealType(1);
         x[j] = t;
     }
     }
-    for(unsigned int j = short_lag; j < long_lag; ++j) {
+    for(unsigned int j = fill_range(short_lag, long_lag, 0, simd_type());
+        j < long_lag; ++j) {
         RealType t = x[j] + x[j-short_lag];
         if(t >= RealType(1))
             t -= RealType(1);
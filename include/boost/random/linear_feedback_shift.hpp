@@ -16,6 +16,7 @@
 #define BOOST_RANDOM_LINEAR_FEEDBACK_SHIFT_HPP
 
 #include <iosfwd>
+#include <algorithm>
 #include <stdexcept>
 #include <boost/config.hpp>
 #include <boost/cstdint.hpp>
@@ -116,9 +117,7 @@ public:
     /** Returns the next value of the generator. */
     result_type operator()()
     {
-        const UIntType b = (((value << q) ^ value) & wordmask()) >> (k-s);
-        const UIntType mask = (wordmask() << (w-k)) & wordmask();
-        value = ((value & mask) << s) ^ b;
+        value = step(value);
         return value;
     }
   
@@ -127,11 +126,21 @@ public:
     void generate(Iter first, Iter last)
     { detail::generate_from_int(*this, first, last); }
 
-    /** Advances the state of the generator by @c z. */
+    /**
+     * Advances the state of the generator by @c z.  Large jumps use
+     * the GF(2) transition matrix and take O(w^2 log z) time.
+     */
     void discard(boost::uintmax_t z)
     {
-        for(boost::uintmax_t j = 0; j < z; ++j) {
-            (*this)();
+#ifndef BOOST_RANDOM_LINEAR_FEEDBACK_SHIFT_DISCARD_THRESHOLD
+#define BOOST_RANDOM_LINEAR_FEEDBACK_SHIFT_DISCARD_THRESHOLD 4
+#endif
+        if(z >= BOOST_RANDOM_LINEAR_FEEDBACK_SHIFT_DISCARD_THRESHOLD * jump_cost(z)) {
+            jump(z);
+        } else {
+            for(boost::uintmax_t j = 0; j < z; ++j) {
+                (*this)();
+            }
         }
     }
     
@@ -169,6 +178,53 @@ public:
 private:
     /// \cond show_private
     static BOOST_CONSTEXPR UIntType wordmask() { return boost::low_bits_mask_t<w>::sig_bits; }
+
+    static UIntType step(UIntType v)
+    {
+        const UIntType b = (((v << q) ^ v) & wordmask()) >> (k-s);
+        const UIntType mask = (wordmask() << (w-k)) & wordmask();
+        return ((v & mask) << s) ^ b;
+    }
+
+    // A step is linear over GF(2) and only reads the low w bits of
+    // the state, so it is given by the images of the w unit vectors.
+    static UIntType apply(const UIntType* m, UIntType v)
+    {
+        UIntType result = 0;
+        for(int j = 0; j < w; ++j) {
+            result ^= m[j] & (UIntType(0) - ((v >> j) & 1u));
+        }
+        return result;
+    }
+
+    static boost::uintmax_t jump_cost(boost::uintmax_t z)
+    {
+        boost::uintmax_t result = 0;
+        for(; z != 0; z >>= 1) {
+            result += w * w;
+        }
+        return result;
+    }
+
+    void jump(boost::uintmax_t z)
+    {
+        UIntType m[w];
+        UIntType tmp[w];
+        for(int j = 0; j < w; ++j) {
+            m[j] = step(UIntType(1) << j);
+        }
+        for(;;) {
+            if(z & 1u) {
+                value = apply(m, value);
+            }
+            z >>= 1;
+            if(z == 0) break;
+            for(int j = 0; j < w; ++j) {
+                tmp[j] = apply(m, m[j]);
+            }
+            std::copy(tmp, tmp + w, m);
+        }
+    }
     /// \endcond
     UIntType value;
 };
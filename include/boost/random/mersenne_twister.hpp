@@ -20,11 +20,16 @@
 
 #include <iosfwd>
 #include <istream>
+#include <limits>
 #include <stdexcept>
+#include <algorithm>
 #include <boost/config.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/integer/integer_mask.hpp>
+#include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/random/detail/config.hpp>
+#include <boost/random/detail/simd.hpp>
 #include <boost/random/detail/ptr_helper.hpp>
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/seed_impl.hpp>
@@ -63,6 +68,12 @@ namespace random {
  * The generator requires considerable amounts of memory for the storage of
  * its state array. For example, \mt11213b requires about 1408 bytes and
  * \mt19937 requires about 2496 bytes.
+ *
+ * When the word size matches the width of @c UIntType (as it does for
+ * \mt11213b, \mt19937 and \mt19937_64), the state regeneration and
+ * the tempering in @c generate() use SSE2, AVX2 or AVX-512 instructions
+ * if the translation unit is compiled for them.  The output is identical
+ * to the scalar code.
  */
 template<class UIntType,
          std::size_t w, std::size_t n, std::size_t m, std::size_t r,
@@ -186,10 +197,18 @@ public:
     /** Produces the next value of the generator. */
     result_type operator()();
 
-    /** Fills a range with random values */
+    /**
+     * Fills a range with 32-bit random values, exactly as
+     * @c detail::generate_from_int would.  For 32 and 64 bit words,
+     * whole blocks of the state are tempered at once, and written
+     * directly into the range if it is an array of @c result_type.
+     */
     template<class Iter>
     void generate(Iter first, Iter last)
-    { detail::generate_from_int(*this, first, last); }
+    {
+        generate_impl(first, last,
+            boost::integral_constant<int, (w == 32 || w == 64) ? int(w) : 0>());
+    }
 
     /**
      * Advances the state of the generator by @c z steps.  Equivalent to
@@ -214,6 +233,39 @@ public:
         }
     }
 
+    /**
+     * A precomputed jump of a fixed distance.  Constructing a
+     * @c jump_plan does the expensive polynomial exponentiation
+     * once; applying it to a generator is then equivalent to
+     * calling @c discard(z) on it, at a fraction of the cost.
+     * This is useful for splitting one generator into many
+     * widely spaced substreams:
+     *
+     * @code
+     * mt19937::jump_plan plan(UINTMAX_C(1) << 60);
+     * for(std::size_t k = 1; k < gens.size(); ++k) {
+     *     gens[k] = gens[k - 1];
+     *     plan.apply(gens[k]);
+     * }
+     * @endcode
+     */
+    class jump_plan
+    {
+    public:
+        /** Computes the jump for a distance of @c z. */
+        explicit jump_plan(boost::uintmax_t z)
+          : _distance(z),
+            _g(mod_pow_x(z, mersenne_twister_engine::characteristic_polynomial()))
+        {}
+        /** Returns the number of values skipped by the plan. */
+        boost::uintmax_t distance() const { return _distance; }
+        /** Advances @c gen as if by @c gen.discard(distance()). */
+        void apply(mersenne_twister_engine& gen) const { gen.jump(_g); }
+    private:
+        boost::uintmax_t _distance;
+        detail::polynomial _g;
+    };
+
 #ifndef BOOST_RANDOM_NO_STREAM_OPERATORS
     /** Writes a mersenne_twister_engine to a @c std::ostream */
     template<class CharT, class Traits>
@@ -264,6 +316,126 @@ private:
 
     void twist();
 
+    // The vector type used by twist() and generate(), or simd_none.
+    typedef typename boost::conditional<
+        (w == std::numeric_limits<UIntType>::digits),
+        typename detail::simd_select_word<UIntType>::type,
+        detail::simd_none>::type simd_type;
+
+    /**
+     * Vectorized part of one of the loops in twist().  Updates x[j] for
+     * j in [first, last) in groups of V::width, reading x[src + j - first]
+     * in place of x[j+m].  The distance between the element written and
+     * the elements read is at least n-m, which is larger than any vector,
+     * so the result is the same as the scalar loop.  Returns the first
+     * index that was not updated.
+     */
+    template<class V>
+    std::size_t twist_range(std::size_t first, std::size_t last,
+                            std::size_t src, V)
+    {
+        typedef typename V::type vec;
+        const vec upper = V::set1((~static_cast<UIntType>(0)) << r);
+        const vec lower = V::set1(~((~static_cast<UIntType>(0)) << r));
+        const vec one = V::set1(1);
+        const vec zero = V::set1(0);
+        const vec mag = V::set1(a);
+        const std::size_t end = first + (last - first) / V::width * V::width;
+        for(std::size_t j = first; j != end; j += V::width, src += V::width) {
+            vec xj = V::load(&x[j]);
+            vec xj1 = V::load(&x[j+1]);
+            vec y = V::bor(V::band(xj, upper), V::band(xj1, lower));
+            vec xa = V::band(V::sub(zero, V::band(xj1, one)), mag);
+            V::store(&x[j], V::bxor(V::bxor(V::load(&x[src]),
+                                             V::template shr<1>(y)), xa));
+        }
+        return end;
+    }
+    std::size_t twist_range(std::size_t first, std::size_t, std::size_t,
+                            detail::simd_none)
+    { return first; }
+
+    /** Applies the tempering transformation to count elements. */
+    template<class V>
+    static std::size_t temper_range(const UIntType* src, std::size_t count,
+                                    UIntType* out, V)
+    {
+        typedef typename V::type vec;
+        const vec vd = V::set1(d);
+        const vec vb = V::set1(b);
+        const vec vc = V::set1(c);
+        std::size_t j = 0;
+        for(; j + V::width <= count; j += V::width) {
+            vec z = V::load(src + j);
+            z = V::bxor(z, V::band(V::template shr<static_cast<int>(u)>(z), vd));
+            z = V::bxor(z, V::band(V::template shl<static_cast<int>(s)>(z), vb));
+            z = V::bxor(z, V::band(V::template shl<static_cast<int>(t)>(z), vc));
+            z = V::bxor(z, V::template shr<static_cast<int>(l)>(z));
+            V::store(out + j, z);
+        }
+        return j;
+    }
+    static std::size_t temper_range(const UIntType*, std::size_t,
+                                    UIntType*, detail::simd_none)
+    { return 0; }
+
+    static void temper(const UIntType* src, std::size_t count, UIntType* out)
+    {
+        for(std::size_t j = temper_range(src, count, out, simd_type());
+            j < count; ++j) {
+            UIntType z = src[j];
+            z ^= ((z >> u) & d);
+            z ^= ((z << s) & b);
+            z ^= ((z << t) & c);
+            z ^= (z >> l);
+            out[j] = z;
+        }
+    }
+
+    template<class Iter>
+    void generate_impl(Iter first, Iter last, boost::integral_constant<int, 0>)
+    { detail::generate_from_int(*this, first, last); }
+
+    /**
+     * Bulk version of generate_from_int for w == 32 and w == 64: each
+     * value is written as w/32 words, least significant first.  If the
+     * range ends in the middle of a value, the value is still consumed.
+     */
+    template<class Iter, int Bits>
+    void generate_impl(Iter first, Iter last, boost::integral_constant<int, Bits>)
+    {
+        UIntType buf[n];
+        while(first != last) {
+            if(i == n)
+                twist();
+            const std::size_t count = n - i;
+            temper(&x[i], count, buf);
+            std::size_t j = 0;
+            while(j < count && first != last) {
+                UIntType val = buf[j++];
+                *first++ = static_cast<boost::uint_least32_t>(val) & 0xFFFFFFFFu;
+                if(Bits == 64 && first != last) {
+                    val >>= (Bits / 2);
+                    *first++ = static_cast<boost::uint_least32_t>(val) & 0xFFFFFFFFu;
+                }
+            }
+            i += j;
+        }
+    }
+
+    /** Tempers whole blocks of the state straight into the output. */
+    void generate_impl(UIntType* first, UIntType* last, boost::integral_constant<int, 32>)
+    {
+        while(first != last) {
+            if(i == n)
+                twist();
+            const std::size_t count = (std::min)(n - i, static_cast<std::size_t>(last - first));
+            temper(&x[i], count, first);
+            i += count;
+            first += count;
+        }
+    }
+
     /**
      * Does the work of operator==.  This is in a member function
      * for portability.  Some compilers, such as msvc 7.1 and
@@ -389,21 +561,15 @@ private:
      */
     void discard_many(boost::uintmax_t z)
     {
-        // Compute the minimal polynomial, phi(t)
-        // This depends only on the transition function,
-        // which is constant.  The characteristic
-        // polynomial is the same as the minimal
-        // polynomial for a maximum period generator
-        // (which should be all specializations of
-        // mersenne_twister.)  Even if it weren't,
-        // the characteristic polynomial is guaranteed
-        // to be a multiple of the minimal polynomial,
-        // which is good enough.
-        detail::polynomial phi = get_characteristic_polynomial();
-
         // calculate g(t) = t^z % phi(t)
-        detail::polynomial g = mod_pow_x(z, phi);
+        jump(mod_pow_x(z, characteristic_polynomial()));
+    }
 
+    /**
+     * Advances the state by the distance encoded in g(t) = t^z % phi(t).
+     */
+    void jump(const detail::polynomial& g)
+    {
         // h(s_0, t) = \sum_{i=0}^{2k-1}o(s_i)t^{2k-i-1}
         detail::polynomial h;
         const std::size_t num_bits = w*n - r;
@@ -423,6 +589,24 @@ private:
         }
         reconstruct_state(result);
     }
+    /**
+     * Returns the minimal polynomial, phi(t).
+     * This depends only on the transition function,
+     * which is constant, so it is computed once per
+     * instantiation.  The characteristic
+     * polynomial is the same as the minimal
+     * polynomial for a maximum period generator
+     * (which should be all specializations of
+     * mersenne_twister.)  Even if it weren't,
+     * the characteristic polynomial is guaranteed
+     * to be a multiple of the minimal polynomial,
+     * which is good enough.
+     */
+    static const detail::polynomial& characteristic_polynomial()
+    {
+        static const detail::polynomial phi = get_characteristic_polynomial();
+        return phi;
+    }
     static detail::polynomial get_characteristic_polynomial()
     {
         const std::size_t num_bits = w*n - r;
@@ -535,31 +719,17 @@ mersenne_twister_engine<UIntType,w,n,m,r,a,u,d,s,b,t,c,l,f>::twist()
     const UIntType upper_mask = (~static_cast<UIntType>(0)) << r;
     const UIntType lower_mask = ~upper_mask;
 
-    const std::size_t unroll_factor = 6;
-    const std::size_t unroll_extra1 = (n-m) % unroll_factor;
-    const std::size_t unroll_extra2 = (m-1) % unroll_factor;
-
-    // split loop to avoid costly modulo operations
+    // split loop to avoid costly modulo operations.  The vector
+    // kernels handle as much of each part as they can, and the
+    // scalar loops finish the rest.
     {  // extra scope for MSVC brokenness w.r.t. for scope
-        for(std::size_t j = 0; j < n-m-unroll_extra1; j++) {
-            UIntType y = (x[j] & upper_mask) | (x[j+1] & lower_mask);
-            x[j] = x[j+m] ^ (y >> 1) ^ ((x[j+1]&1) * a);
-        }
-    }
-    {
-        for(std::size_t j = n-m-unroll_extra1; j < n-m; j++) {
+        for(std::size_t j = twist_range(0, n-m, m, simd_type()); j < n-m; j++) {
             UIntType y = (x[j] & upper_mask) | (x[j+1] & lower_mask);
             x[j] = x[j+m] ^ (y >> 1) ^ ((x[j+1]&1) * a);
         }
     }
     {
-        for(std::size_t j = n-m; j < n-1-unroll_extra2; j++) {
-            UIntType y = (x[j] & upper_mask) | (x[j+1] & lower_mask);
-            x[j] = x[j-(n-m)] ^ (y >> 1) ^ ((x[j+1]&1) * a);
-        }
-    }
-    {
-        for(std::size_t j = n-1-unroll_extra2; j < n-1; j++) {
+        for(std::size_t j = twist_range(n-m, n-1, 0, simd_type()); j < n-1; j++) {
             UIntType y = (x[j] & upper_mask) | (x[j+1] & lower_mask);
             x[j] = x[j-(n-m)] ^ (y >> 1) ^ ((x[j+1]&1) * a);
         }
@@ -21,11 +21,117 @@
 #include <sstream>
 #include <cstdint>
 
+#include <boost/assert.hpp>
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/seed_impl.hpp>
+#include <boost/random/detail/large_arithmetic.hpp>
+#include <boost/random/detail/simd.hpp>
 
 namespace boost {
 namespace random {
+namespace detail {
+
+#ifdef BOOST_RANDOM_HAS_AVX512_DISPATCH
+// One step of the MIXMAX recurrence for Y[1..8*Blocks], as prefix sums
+// over vectors of eight lanes.  The scalar code keeps its partial sums
+// reduced only up to 2^61 + 7, so its values are the canonical residues
+// computed here except when a residue is 0, 1 or 2; the kernel then
+// returns false without touching Y, and the scalar code runs instead.
+// The same happens if an input is not canonical.
+
+// GCC 12 warns about the undefined pass-through operand of the unmasked
+// AVX-512 intrinsics once they are inlined here.
+#if defined(BOOST_GCC)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// the residue mod 2^61-1 in [0, 2^61-1) of x < 2^64
+BOOST_RANDOM_TARGET_AVX512 inline __m512i mixmax_canon_avx512(__m512i x)
+{
+    const __m512i m61 = _mm512_set1_epi64(0x1FFFFFFFFFFFFFFFLL);
+    const __m512i t = _mm512_add_epi64(_mm512_and_si512(x, m61), _mm512_srli_epi64(x, 61));
+    return _mm512_and_si512(_mm512_add_epi64(t, _mm512_srli_epi64(_mm512_add_epi64(t, _mm512_set1_epi64(1)), 61)), m61);
+}
+
+// inclusive prefix sums of the eight lanes, without reduction
+BOOST_RANDOM_TARGET_AVX512 inline __m512i mixmax_scan_avx512(__m512i x)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 7));
+    x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 6));
+    return _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 4));
+}
+
+template<unsigned int SPECIALMUL, int Blocks>
+BOOST_RANDOM_TARGET_AVX512 bool mixmax_iterate_avx512(std::uint64_t* Y, std::uint64_t sumtotOld, std::uint64_t& sumtot)
+{
+    const std::uint64_t M61 = 0x1FFFFFFFFFFFFFFFULL;
+    if (sumtotOld >= M61) return false;
+    const __m512i m61 = _mm512_set1_epi64(static_cast<long long>(M61));
+    const __m512i small = _mm512_set1_epi64(3);
+    const __m512i last = _mm512_set1_epi64(7);
+    __mmask8 bad = 0;
+    __m512i P[Blocks];
+    __m512i V[Blocks];
+    // P_i = Y_1 + ... + Y_i
+    for (int b = 0; b < Blocks; ++b){
+        const __m512i y = _mm512_loadu_si512(Y + 1 + 8*b);
+        bad |= _mm512_cmpge_epu64_mask(y, m61);
+        P[b] = mixmax_canon_avx512(mixmax_scan_avx512(y));
+    }
+    __m512i carry = _mm512_setzero_si512();
+    for (int b = 0; b < Blocks; ++b){
+        P[b] = mixmax_canon_avx512(_mm512_add_epi64(P[b], carry));
+        carry = _mm512_permutexvar_epi64(last, P[b]);
+    }
+    // V_i = V_0 + sum over j <= i of P_j + P_{j-1} * 2^SPECIALMUL
+    __m512i before = _mm512_setzero_si512();
+    for (int b = 0; b < Blocks; ++b){
+        bad |= _mm512_cmplt_epu64_mask(P[b], small);
+        const __m512i prev = _mm512_alignr_epi64(P[b], before, 7);
+        const __m512i po = _mm512_xor_si512(_mm512_and_si512(_mm512_slli_epi64(prev, SPECIALMUL), m61),
+                                            _mm512_srli_epi64(prev, 61 - SPECIALMUL));
+        V[b] = mixmax_canon_avx512(mixmax_scan_avx512(mixmax_canon_avx512(_mm512_add_epi64(po, P[b]))));
+        before = P[b];
+    }
+    carry = _mm512_set1_epi64(static_cast<long long>(sumtotOld));
+    for (int b = 0; b < Blocks; ++b){
+        V[b] = mixmax_canon_avx512(_mm512_add_epi64(V[b], carry));
+        carry = _mm512_permutexvar_epi64(last, V[b]);
+    }
+    for (int b = 0; b < Blocks; ++b){
+        bad |= _mm512_cmplt_epu64_mask(V[b], small);
+    }
+    if (bad) return false;
+    // the sum of all the values as a 128-bit number, from the sums of
+    // their 32-bit halves
+    const __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFFLL);
+    __m512i lsum = _mm512_setzero_si512();
+    __m512i hsum = _mm512_setzero_si512();
+    Y[0] = sumtotOld;
+    for (int b = 0; b < Blocks; ++b){
+        _mm512_storeu_si512(Y + 1 + 8*b, V[b]);
+        lsum = _mm512_add_epi64(lsum, _mm512_and_si512(V[b], lo32));
+        hsum = _mm512_add_epi64(hsum, _mm512_srli_epi64(V[b], 32));
+    }
+    const std::uint64_t l = static_cast<std::uint64_t>(_mm512_reduce_add_epi64(lsum)) + (sumtotOld & 0xFFFFFFFFULL);
+    const std::uint64_t h = static_cast<std::uint64_t>(_mm512_reduce_add_epi64(hsum)) + (sumtotOld >> 32);
+    const std::uint64_t total_lo = l + (h << 32);
+    const std::uint64_t total_hi = (h + (l >> 32)) >> 32;
+    const std::uint64_t r = (total_lo & M61) + (total_lo >> 61);
+    const std::uint64_t t = r + (total_hi << 3);
+    sumtot = (t & M61) + (t >> 61);
+    return true;
+}
+
+#if defined(BOOST_GCC)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+} // namespace detail
 
 /**
  * Instantiations of class template mixmax_engine model,
@@ -53,6 +159,13 @@ namespace random {
  * The generator crucially depends on the choice of the
  * parameters. The valid sets of parameters are from the published papers above.
  *
+ * The multiply-accumulate over the whole state vector used by seeding and
+ * @c discard() uses SSE2, AVX2 or AVX-512 instructions if the translation
+ * unit is compiled for them.  The step of the recurrence that produces
+ * each block of output is computed as prefix sums with AVX-512F when the
+ * processor supports it, chosen at run time on GCC and Clang for x86,
+ * and otherwise with scalar code.  The results are identical either way.
+ *
  */
 
 template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> // MIXMAX TEMPLATE PARAMETERS
@@ -111,11 +224,69 @@ public: // SEEDING FUNCTIONS
         }
     }
 
-    /** Fills a range with random values */
+    /**
+     * Fills a range with 32-bit random values, exactly as
+     * @c detail::generate_from_int would.  The 61-bit values are taken
+     * from whole blocks of @c S.V as @c iterate_raw_vec produces them.
+     * If the range ends in the middle of a value, the value is still consumed.
+     */
     template<class Iter>
-    void generate(Iter first, Iter last) { detail::generate_from_int(*this, first, last); }
+    void generate(Iter first, Iter last){
+        int remaining_bits = 0;
+        std::uint32_t saved_bits = 0;
+        while (first != last){
+            if (S.counter > (Ndim-1)){
+                S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+                S.counter = 1;
+            }
+            while (S.counter <= (Ndim-1)){
+                std::uint64_t val = S.V[S.counter++];
+                int available_bits = BITS;
+                if (remaining_bits != 0){
+                    std::uint32_t extra_bits = std::uint32_t(val) & ((std::uint32_t(1) << (32 - remaining_bits)) - 1);
+                    val >>= 32 - remaining_bits;
+                    *first++ = saved_bits | (extra_bits << remaining_bits);
+                    if (first == last) return;
+                    available_bits -= 32 - remaining_bits;
+                }
+                for (; available_bits >= 32; available_bits -= 32){
+                    *first++ = std::uint32_t(val);
+                    val >>= 32;
+                    if (first == last) return;
+                }
+                remaining_bits = available_bits;
+                saved_bits = std::uint32_t(val);
+            }
+        }
+    }
 
-    void discard(std::uint64_t nsteps) { for(std::uint64_t j = 0; j < nsteps; ++j)  (*this)(); } ///< discard n steps, required in boost::random
+    /**
+     * Advances the state of the generator by @c nsteps outputs, required in boost::random.
+     * Whole iterations of the MIXMAX matrix A are skipped by computing
+     * x^k mod the characteristic polynomial of A over GF(2^61-1) and applying
+     * the result to the state, in the same way as the seeding skip matrices,
+     * so large distances take O(N^2 log nsteps) time.
+     */
+    void discard(std::uint64_t nsteps){
+        const std::uint64_t available = std::uint64_t(Ndim - S.counter);
+        if (nsteps <= available){
+            S.counter += int(nsteps);
+            return;
+        }
+        nsteps -= available;
+        const std::uint64_t iterations = (nsteps - 1) / (Ndim - 1) + 1;
+        S.counter = int(nsteps - (iterations - 1) * (Ndim - 1)) + 1;
+#ifndef BOOST_RANDOM_MIXMAX_DISCARD_THRESHOLD
+#define BOOST_RANDOM_MIXMAX_DISCARD_THRESHOLD 256
+#endif
+        if (iterations > BOOST_RANDOM_MIXMAX_DISCARD_THRESHOLD){
+            S.sumtot = apply_poly(S.V.data(), mod_pow_x(iterations).data());
+        }else{
+            for (std::uint64_t j = 0; j < iterations; ++j){
+                S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+            }
+        }
+    }
 
     /** save the state of the RNG to a stream */
     template<class CharT, class Traits>
@@ -171,6 +342,19 @@ inline std::uint64_t iterate_raw_vec(std::uint64_t* Y, std::uint64_t sumtotOld);
 inline std::uint64_t apply_bigskip(std::uint64_t* Vout, std::uint64_t* Vin, uint32_t clusterID, uint32_t machineID, uint32_t runID, uint32_t  streamID );
 inline std::uint64_t modadd(std::uint64_t foo, std::uint64_t bar);
 inline std::uint64_t fmodmulM61(std::uint64_t cum, std::uint64_t s, std::uint64_t a);
+inline void fmodmul_vec(std::uint64_t* cum, std::uint64_t s, const std::uint64_t* a); // cum[i] = fmodmulM61(cum[i], s, a[i]) for all i
+template<class V> static int fmodmul_range(std::uint64_t* cum, std::uint64_t s, const std::uint64_t* a, V);
+static int fmodmul_range(std::uint64_t*, std::uint64_t, const std::uint64_t*, detail::simd_none) { return 0; }
+typedef std::array<std::uint64_t, Ndim> poly_t; // coefficients of a polynomial of degree < Ndim over GF(M61)
+static inline std::uint64_t mulmodM61(std::uint64_t a, std::uint64_t b);  // canonical a*b mod M61
+static inline std::uint64_t addmodM61(std::uint64_t a, std::uint64_t b);  // canonical a+b mod M61
+static inline std::uint64_t invmodM61(std::uint64_t a);
+static inline void mulacc128(std::uint64_t* acc, std::uint64_t a, std::uint64_t b); // acc += a*b, as an unreduced 128-bit value
+static inline std::uint64_t reduce128M61(const std::uint64_t* acc);              // canonical acc mod M61
+static const poly_t& charpoly_reduction();      // r with x^Ndim = sum r_i x^i mod the characteristic polynomial of A
+static poly_t compute_charpoly_reduction();
+static poly_t mod_pow_x(std::uint64_t k);       // x^k mod the characteristic polynomial of A
+inline std::uint64_t apply_poly(std::uint64_t* Y, const std::uint64_t* coeffs); // Y = g(A) Y, returns the new sumtot
 };
 
 template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::mixmax_engine()
@@ -193,6 +377,14 @@ template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> uint64_t mixm
 
 template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::iterate_raw_vec(std::uint64_t* Y, std::uint64_t sumtotOld){
     // operates with a raw vector, uses known sum of elements of Y
+#ifdef BOOST_RANDOM_HAS_AVX512_DISPATCH
+    if ((Ndim - 1) % 8 == 0 && detail::cpu_has_avx512f()){
+        std::uint64_t result;
+        if (detail::mixmax_iterate_avx512<SPECIALMUL, ((Ndim - 1) % 8 == 0 ? (Ndim - 1) / 8 : 1)>(Y, sumtotOld, result)){
+            return result;
+        }
+    }
+#endif
     std::uint64_t  tempP=0, tempV=sumtotOld;
     Y[0] = tempV;
     std::uint64_t sumtot = Y[0], ovflow = 0; // will keep a running sum of all new elements
@@ -246,7 +438,7 @@ template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> std::uint64_t
      */
 
 
-    const    std::uint64_t skipMat17[128][17] =
+    static const std::uint64_t skipMat17[128][17] =
 #include "boost/random/detail/mixmax_skip_N17.ipp"
     ;
 
@@ -269,9 +461,7 @@ template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> std::uint64_t
                 for (int j=0; j<Ndim; j++){              // j is lag, enumerates terms of the poly
                     // for zero lag Y is already given
                     std::uint64_t coeff = rowPtr[j]; // same coeff for all i
-                    for (int i =0; i<Ndim; i++){
-                        cum[i] =  fmodmulM61( cum[i], coeff ,  Y[i] ) ;
-                    }
+                    fmodmul_vec(cum, coeff, Y);
                     sumtot = iterate_raw_vec(Y, sumtot);
                 }
                 sumtot=0;
@@ -300,10 +490,175 @@ template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline std::u
     return o;
 }
 
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline void mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::fmodmul_vec(std::uint64_t* cum, std::uint64_t s, const std::uint64_t* a){
+    for (int i = fmodmul_range(cum, s, a, typename detail::simd_select_word<std::uint64_t>::type()); i<Ndim; i++){
+        cum[i] = fmodmulM61(cum[i], s, a[i]);
+    }
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> template<class V> int mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::fmodmul_range(std::uint64_t* cum, std::uint64_t s, const std::uint64_t* a, V){
+    // fmodmulM61 in groups of V::width lanes, with the same 32x32 bit partial products
+    typedef typename V::type vec;
+    const vec m61 = V::set1(M61);
+    const vec sl = V::set1(s & 0xFFFFFFFFULL);
+    const vec sh = V::set1(s >> 32);
+    int i = 0;
+    for (; i + int(V::width) <= Ndim; i += int(V::width)){
+        const vec av = V::load(a + i);
+        const vec ah = V::template shr<32>(av);
+        const vec alpl = V::mul32(av, sl);
+        const vec ahpl = V::mul32(ah, sl);
+        const vec alph = V::mul32(av, sh);
+        const vec ahph = V::mul32(ah, sh);
+        vec o = V::add(alpl, V::template shl<32>(V::add(ahpl, alph)));   // s*a mod 2^64
+        o = V::add(V::add(V::band(o, m61), V::template shl<3>(ahph)),
+                   V::template shr<29>(V::add(V::add(ahpl, alph), V::template shr<32>(alpl))));
+        o = V::add(o, V::load(cum + i));
+        o = V::add(V::band(o, m61), V::template shr<61>(o));
+        V::store(cum + i, o);
+    }
+    return i;
+}
+
 template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::modadd(std::uint64_t foo, std::uint64_t bar){
     return MOD_MERSENNE(foo+bar);
 }
 
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::mulmodM61(std::uint64_t a, std::uint64_t b){
+    std::uint64_t hi;
+    std::uint64_t lo = detail::umul128(a, b, hi);
+    std::uint64_t r = (lo & M61) + ((lo >> BITS) | (hi << (64 - BITS)));
+    r = (r & M61) + (r >> BITS);
+    return r == M61 ? 0 : r;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::addmodM61(std::uint64_t a, std::uint64_t b){
+    std::uint64_t r = a + b;
+    return r >= M61 ? r - M61 : r;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline void mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::mulacc128(std::uint64_t* acc, std::uint64_t a, std::uint64_t b){
+    std::uint64_t hi;
+    const std::uint64_t lo = detail::umul128(a, b, hi);
+    acc[0] += lo;
+    acc[1] += hi + (acc[0] < lo);
+    if (acc[1] >> 62) { acc[1] = (acc[1] & M61) + (acc[1] >> BITS); } // hi*2^64 is only needed mod M61; never taken for small Ndim
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::reduce128M61(const std::uint64_t* acc){
+    // acc[1]*2^64 + acc[0] = acc[1]*8 + acc[0] mod M61
+    std::uint64_t h = (acc[1] & M61) + (acc[1] >> BITS);
+    if (h >= M61) { h -= M61; }
+    h = ((h << 3) & M61) | (h >> (BITS - 3));
+    std::uint64_t r = (acc[0] & M61) + (acc[0] >> BITS) + h;
+    r = (r & M61) + (r >> BITS);
+    return r >= M61 ? r - M61 : r;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> inline std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::invmodM61(std::uint64_t a){
+    // Fermat: a^(M61-2)
+    std::uint64_t result = 1, e = M61 - 2;
+    while (e){
+        if (e & 1) { result = mulmodM61(result, a); }
+        a = mulmodM61(a, a);
+        e >>= 1;
+    }
+    return result;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> const typename mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::poly_t& mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::charpoly_reduction(){
+    // depends only on the matrix, so it is computed once
+    static const poly_t r = compute_charpoly_reduction();
+    return r;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> typename mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::poly_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::compute_charpoly_reduction(){
+    /*
+     The characteristic polynomial of A is irreducible for the published parameter sets,
+     so it is the minimal polynomial of the sequence of first components of A^k e_0.
+     Find it with Berlekamp-Massey over GF(M61).
+     */
+    std::uint64_t seq[2*Ndim];
+    {
+        mixmax_engine tmp;
+        tmp.seed_vielbein(&tmp.S, 0);
+        for (int k=0; k<2*Ndim; k++){
+            seq[k] = tmp.S.V[0] % M61;
+            tmp.S.sumtot = tmp.iterate_raw_vec(tmp.S.V.data(), tmp.S.sumtot);
+        }
+    }
+
+    std::uint64_t C[2*Ndim+1] = {1}, B[2*Ndim+1] = {1}, T[2*Ndim+1];
+    int L = 0, m = 1;
+    std::uint64_t b = 1;
+    for (int n=0; n<2*Ndim; n++){
+        std::uint64_t d = seq[n];
+        for (int i=1; i<=L; i++) { d = addmodM61(d, mulmodM61(C[i], seq[n-i])); }
+        if (d == 0) { m++; continue; }
+        const std::uint64_t coeff = mulmodM61(d, invmodM61(b));
+        const bool grow = (2*L <= n);
+        if (grow) { for (int i=0; i<=2*Ndim; i++) { T[i] = C[i]; } }
+        for (int i=0; i+m<=2*Ndim; i++) { C[i+m] = addmodM61(C[i+m], M61 - mulmodM61(coeff, B[i])); }
+        if (grow){
+            L = n + 1 - L;
+            for (int i=0; i<=2*Ndim; i++) { B[i] = T[i]; }
+            b = d; m = 1;
+        }else{
+            m++;
+        }
+    }
+    BOOST_ASSERT(L == Ndim);
+
+    // phi(x) = x^Ndim + sum_i C[Ndim-i] x^i, so x^Ndim = sum_i -C[Ndim-i] x^i
+    poly_t r;
+    for (int i=0; i<Ndim; i++) { r[i] = C[Ndim-i] == 0 ? 0 : M61 - C[Ndim-i]; }
+    return r;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> typename mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::poly_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::mod_pow_x(std::uint64_t k){
+    const poly_t& r = charpoly_reduction();
+    poly_t g = {{1}};
+    int bit = 63;
+    while (bit >= 0 && !((k >> bit) & 1)) { bit--; }
+    for (; bit >= 0; bit--){
+        // g = g^2, with the products summed in 128 bits and reduced once per coefficient
+        std::uint64_t prod[2*Ndim-1][2] = {{0}};
+        for (int i=0; i<Ndim; i++){
+            if (g[i] == 0) continue;
+            mulacc128(prod[2*i], g[i], g[i]);
+            const std::uint64_t twice = addmodM61(g[i], g[i]);
+            for (int j=i+1; j<Ndim; j++){ mulacc128(prod[i+j], twice, g[j]); }
+        }
+        for (int t=2*Ndim-2; t>=Ndim; t--){
+            const std::uint64_t c = reduce128M61(prod[t]);
+            if (c == 0) continue;
+            for (int i=0; i<Ndim; i++){ mulacc128(prod[t-Ndim+i], c, r[i]); }
+        }
+        for (int i=0; i<Ndim; i++) { g[i] = reduce128M61(prod[i]); }
+        // g = g*x
+        if ((k >> bit) & 1){
+            const std::uint64_t c = g[Ndim-1];
+            for (int i=Ndim-1; i>0; i--) { g[i] = addmodM61(g[i-1], mulmodM61(c, r[i])); }
+            g[0] = mulmodM61(c, r[0]);
+        }
+    }
+    return g;
+}
+
+template <int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL> std::uint64_t mixmax_engine  <Ndim, SPECIALMUL, SPECIAL> ::apply_poly(std::uint64_t* Y, const std::uint64_t* coeffs){
+    // same scheme as apply_bigskip: cum = sum_j coeffs[j] A^j Y
+    std::uint64_t cum[Ndim] = {0};
+    std::uint64_t sumtot = 0;
+    for (int i=0; i<Ndim; i++) { sumtot = modadd(sumtot, Y[i]); }
+    for (int j=0; j<Ndim; j++){
+        fmodmul_vec(cum, coeffs[j], Y);
+        sumtot = iterate_raw_vec(Y, sumtot);
+    }
+    sumtot = 0;
+    for (int i=0; i<Ndim; i++){ Y[i] = cum[i]; sumtot = modadd(sumtot, cum[i]); }
+    return sumtot;
+}
+
 /* @copydoc boost::random::detail::mixmax_engine_doc */
 /** Instantiation with a valid parameter set. */
 typedef mixmax_engine<17,36,0>          mixmax;
@@ -0,0 +1,200 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_PARALLEL_GENERATE_HPP
+#define BOOST_RANDOM_PARALLEL_GENERATE_HPP
+
+#include <boost/random/traits.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// Chunks are made of blocks of an odd multiple of this many elements.
+#ifndef BOOST_RANDOM_PARALLEL_GENERATE_BLOCK
+#define BOOST_RANDOM_PARALLEL_GENERATE_BLOCK 32
+#endif
+
+// Packing integers into words rejects values when the range of the
+// engine is not a power of two, so the number of values consumed by a
+// range depends on the values themselves.
+template<class Engine>
+bool generate_may_reject(std::true_type)
+{
+    typedef typename boost::random::traits::make_unsigned<
+        typename Engine::result_type>::type unsigned_type;
+    const unsigned_type range = static_cast<unsigned_type>(
+        static_cast<unsigned_type>((Engine::max)()) - static_cast<unsigned_type>((Engine::min)()));
+    return (range & static_cast<unsigned_type>(range + 1)) != 0;
+}
+
+template<class Engine>
+bool generate_may_reject(std::false_type)
+{
+    return false;
+}
+
+// Returns the number of calls to operator() that take a copy of before
+// to after, or 0 if it is more than limit.
+template<class Engine>
+std::uintmax_t engine_distance(const Engine& before, const Engine& after, std::uintmax_t limit)
+{
+    Engine e(before);
+    for(std::uintmax_t d = 1; d <= limit; ++d) {
+        e();
+        if(e == after) return d;
+    }
+    return 0;
+}
+
+// Finds a block size such that generate() over consecutive blocks of
+// that many elements gives the same values as one call over all of
+// them, and each block takes the same number of engine values.  Both
+// are tested on the first two blocks; they then hold for every block
+// because, without rejection, the way generate() packs values into
+// the output does not depend on the values.  Packing b-bit values into
+// 32-bit words repeats every b / gcd(b, 32) words, which is odd, so
+// odd multiples of the base block are tried.  Returns false if no
+// such block size is found.
+template<class Engine, class T>
+bool find_generate_block(const Engine& eng, std::size_t& block, std::uintmax_t& values)
+{
+    if(generate_may_reject<Engine>(
+        std::integral_constant<bool, boost::random::traits::is_integral<typename Engine::result_type>::value>())) {
+        return false;
+    }
+    for(std::size_t m = 1; m < 64; m += 2) {
+        block = m * BOOST_RANDOM_PARALLEL_GENERATE_BLOCK;
+        std::vector<T> whole(2 * block);
+        std::vector<T> parts(2 * block);
+        Engine serial(eng);
+        serial.generate(whole.begin(), whole.end());
+        Engine first(eng);
+        first.generate(parts.begin(), parts.begin() + block);
+        Engine second(first);
+        second.generate(parts.begin() + block, parts.end());
+        if(whole != parts || !(second == serial)) {
+            continue;
+        }
+        values = engine_distance(eng, first, 64 * block);
+        if(values != 0 && engine_distance(first, second, values) == values) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Joins the threads still running when it goes out of scope, so that
+// an exception cannot destroy a joinable std::thread.
+struct join_threads
+{
+    std::vector<std::thread>& threads;
+    ~join_threads()
+    {
+        for(std::size_t i = 0; i < threads.size(); ++i) {
+            if(threads[i].joinable()) threads[i].join();
+        }
+    }
+};
+
+} // namespace detail
+
+/**
+ * Fills [first, last) with the same values as @c eng.generate(first, last)
+ * and leaves @c eng in the same state, using @c threads threads.
+ *
+ * The range is cut into chunks, and each thread moves its own copy of
+ * the engine to the start of its chunk with @c discard() before
+ * calling @c generate() on it.  The result does not depend on the
+ * number of threads.  The engine's @c discard() should be fast, as it
+ * is for the linear congruential, Mersenne twister, xoshiro, PCG,
+ * counter-based and ranlux engines.
+ *
+ * Engines that may reject values when packing them into the output
+ * (integer engines whose range is not a power of two) consume a
+ * number of values that depends on the values themselves, so the
+ * chunk starts cannot be computed.  For those, and for short ranges,
+ * the range is filled by a single call to @c eng.generate().
+ *
+ * If @c discard() or @c generate() throws in any thread, all threads
+ * are joined, the exception from the first chunk that failed is
+ * rethrown and @c eng is left unchanged.  The values in [first, last)
+ * are then unspecified.
+ */
+template<class Engine, class RandomAccessIter>
+void parallel_generate(Engine& eng, RandomAccessIter first, RandomAccessIter last,
+                       std::size_t threads = std::thread::hardware_concurrency())
+{
+    typedef typename std::iterator_traits<RandomAccessIter>::value_type value_type;
+    typedef typename std::iterator_traits<RandomAccessIter>::difference_type difference_type;
+
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    std::size_t block = 0;
+    std::uintmax_t values = 0;
+    if(threads < 2 || n < 64 * threads * BOOST_RANDOM_PARALLEL_GENERATE_BLOCK ||
+       !detail::find_generate_block<Engine, value_type>(eng, block, values) ||
+       n < 2 * threads * block) {
+        eng.generate(first, last);
+        return;
+    }
+
+    // whole blocks per chunk; the last chunk also takes the remainder
+    const std::size_t blocks = n / block / threads;
+    const std::size_t chunk = blocks * block;
+    std::vector<Engine> engines(threads, eng);
+    std::vector<std::exception_ptr> errors(threads);
+    const auto work = [&](std::size_t t) {
+        try {
+            engines[t].discard(values * blocks * t);
+            const RandomAccessIter begin = first + static_cast<difference_type>(chunk * t);
+            const RandomAccessIter end = t + 1 == threads ?
+                last : begin + static_cast<difference_type>(chunk);
+            engines[t].generate(begin, end);
+        } catch(...) {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    std::size_t t = 1;
+    {
+        detail::join_threads guard = { workers };
+        try {
+            workers.reserve(threads - 1);
+            for(; t < threads; ++t) {
+                workers.push_back(std::thread(work, t));
+            }
+        } catch(...) {
+            // out of threads: do the remaining chunks here
+        }
+        work(0);
+        for(std::size_t r = t; r < threads; ++r) {
+            work(r);
+        }
+    }
+    for(std::size_t i = 0; i < threads; ++i) {
+        if(errors[i]) std::rethrow_exception(errors[i]);
+    }
+    eng = engines[threads - 1];
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_PARALLEL_GENERATE_HPP
@@ -0,0 +1,528 @@
+/* boost random/pcg.hpp header file
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_PCG_HPP
+#define BOOST_RANDOM_PCG_HPP
+
+#include <iosfwd>
+#include <istream>
+#include <stdexcept>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/random/detail/config.hpp>
+#include <boost/random/detail/large_arithmetic.hpp>
+#include <boost/random/detail/seed.hpp>
+
+#include <boost/random/detail/disable_warnings.hpp>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// Multipliers and default increments from the reference implementation.
+template<class StateType>
+struct pcg_default;
+
+template<>
+struct pcg_default<boost::uint64_t>
+{
+    static boost::uint64_t multiplier()
+    { return UINT64_C(6364136223846793005); }
+    static boost::uint64_t increment()
+    { return UINT64_C(1442695040888963407); }
+};
+
+template<>
+struct pcg_default<uint128>
+{
+    static uint128 multiplier()
+    { return make_uint128(UINT64_C(2549297995355413924), UINT64_C(4865540595714422341)); }
+    static uint128 increment()
+    { return make_uint128(UINT64_C(6364136223846793005), UINT64_C(1442695040888963407)); }
+};
+
+inline boost::uint32_t pcg_rotr(boost::uint32_t x, unsigned r)
+{ return (x >> r) | (x << ((32 - r) & 31)); }
+
+inline boost::uint64_t pcg_rotr(boost::uint64_t x, unsigned r)
+{ return (x >> r) | (x << ((64 - r) & 63)); }
+
+// Output permutations.  The 64-bit state variants permute the state
+// before it is advanced so that the multiply overlaps the permutation,
+// the 128-bit variant the state after it, as in the reference.
+
+// xorshift high, random rotation
+struct pcg_xsh_rr_64_32
+{
+    typedef boost::uint64_t state_type;
+    typedef boost::uint32_t result_type;
+    BOOST_STATIC_CONSTANT(bool, output_previous = true);
+    static result_type apply(state_type x)
+    {
+        unsigned rot = static_cast<unsigned>(x >> 59);
+        return pcg_rotr(static_cast<boost::uint32_t>(((x >> 18) ^ x) >> 27), rot);
+    }
+};
+
+// xorshift high, random shift
+struct pcg_xsh_rs_64_32
+{
+    typedef boost::uint64_t state_type;
+    typedef boost::uint32_t result_type;
+    BOOST_STATIC_CONSTANT(bool, output_previous = true);
+    static result_type apply(state_type x)
+    {
+        unsigned shift = static_cast<unsigned>(x >> 61);
+        x ^= x >> 22;
+        return static_cast<result_type>(x >> (22 + shift));
+    }
+};
+
+// xorshift low, random rotation
+struct pcg_xsl_rr_128_64
+{
+    typedef uint128 state_type;
+    typedef boost::uint64_t result_type;
+    BOOST_STATIC_CONSTANT(bool, output_previous = false);
+    static result_type apply(const state_type& x)
+    {
+        boost::uint64_t hi = high_bits(x);
+        return pcg_rotr(hi ^ low_bits(x), static_cast<unsigned>(hi >> 58));
+    }
+};
+
+// Stream selection.  The increment is stored only when it can be set.
+struct pcg_setseq_stream {};
+struct pcg_oneseq_stream {};
+struct pcg_mcg_stream {};
+
+template<class StateType, class Stream>
+class pcg_increment;
+
+template<class StateType>
+class pcg_increment<StateType, pcg_setseq_stream>
+{
+public:
+    pcg_increment() : _inc(pcg_default<StateType>::increment()) {}
+    StateType increment() const { return _inc; }
+protected:
+    StateType _inc;
+};
+
+template<class StateType>
+class pcg_increment<StateType, pcg_oneseq_stream>
+{
+public:
+    static StateType increment() { return pcg_default<StateType>::increment(); }
+};
+
+template<class StateType>
+class pcg_increment<StateType, pcg_mcg_stream>
+{
+public:
+    static StateType increment() { return StateType(0); }
+};
+
+template<class CharT, class Traits>
+void pcg_write(std::basic_ostream<CharT, Traits>& os, boost::uint64_t x)
+{ os << x; }
+
+template<class CharT, class Traits>
+void pcg_read(std::basic_istream<CharT, Traits>& is, boost::uint64_t& x)
+{ is >> x; }
+
+// 128-bit values are written as their high and low halves.
+template<class CharT, class Traits>
+void pcg_write(std::basic_ostream<CharT, Traits>& os, const uint128& x)
+{ os << high_bits(x) << ' ' << low_bits(x); }
+
+template<class CharT, class Traits>
+void pcg_read(std::basic_istream<CharT, Traits>& is, uint128& x)
+{
+    boost::uint64_t hi, lo;
+    if(is >> hi >> std::ws >> lo) {
+        x = make_uint128(hi, lo);
+    }
+}
+
+} // namespace detail
+
+/**
+ * Instantiations of class template pcg_engine model a
+ * \pseudo_random_number_generator. PCG generators are described in
+ *
+ *  @blockquote
+ *  "PCG: A Family of Simple Fast Space-Efficient Statistically Good
+ *  Algorithms for Random Number Generation", Melissa E. O'Neill,
+ *  Harvey Mudd College, Technical Report HMC-CS-2014-0905, 2014
+ *  @endblockquote
+ *
+ * The state is a linear congruential generator modulo 2^64 or 2^128
+ * and each output is a permutation of the state, given by @c Output.
+ * @c Stream selects the increment: @c detail::pcg_setseq_stream stores
+ * an increment that can be changed with @c set_stream, giving 2^63 or
+ * 2^127 distinct streams, @c detail::pcg_oneseq_stream uses a fixed one
+ * and @c detail::pcg_mcg_stream uses zero, making the state a
+ * multiplicative generator with a period a quarter as long.
+ *
+ * Seeding from an integer and the results for a given seed and stream
+ * follow the reference implementation, pcg-cpp.  @c discard takes
+ * O(log z) time.
+ *
+ * Note: User code should use one of the typedefs such as @c pcg32
+ * instead of naming the template arguments directly.
+ */
+template<class Output, class Stream>
+class pcg_engine
+    : private detail::pcg_increment<typename Output::state_type, Stream>
+{
+public:
+    typedef typename Output::result_type result_type;
+    typedef typename Output::state_type state_type;
+    typedef state_type stream_type;
+
+    // Required for old Boost.Random concept
+    BOOST_STATIC_CONSTANT(bool, has_fixed_range = false);
+
+    BOOST_STATIC_CONSTANT(boost::uint64_t, default_seed = UINT64_C(0xcafef00dd15ea5e5));
+
+    /**
+     * Constructs a @c pcg_engine, using the default seed
+     */
+    pcg_engine() { seed(); }
+
+    /**
+     * Constructs a @c pcg_engine, seeding it with @c x0.
+     */
+    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(pcg_engine, boost::uint64_t, x0)
+    { seed(x0); }
+
+    /**
+     * Constructs a @c pcg_engine on the given stream, seeding it with
+     * @c x0.  Only available when the stream can be set.
+     */
+    pcg_engine(boost::uint64_t x0, const stream_type& stream)
+    { seed(x0, stream); }
+
+    /**
+     * Constructs a @c pcg_engine, seeding it with values
+     * produced by a call to @c seq.generate().
+     */
+    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(pcg_engine, SeedSeq, seq)
+    { seed(seq); }
+
+    /**
+     * Constructs a @c pcg_engine and seeds it with values taken
+     * from the itrator range [first, last) and adjusts first to point
+     * to the element after the last one used.  If there are not enough
+     * elements, throws @c std::invalid_argument.
+     *
+     * first and last must be input iterators.
+     */
+    template<class It>
+    pcg_engine(It& first, It last,
+               typename boost::disable_if<boost::is_arithmetic<It> >::type* = 0)
+    { seed(first, last); }
+
+    // compiler-generated copy constructor and assignment operator are fine
+
+    /**
+     * Calls seed(default_seed)
+     */
+    void seed() { seed(default_seed); }
+
+    /**
+     * Sets the state to the one that the reference implementation uses
+     * for the seed @c x0, keeping the current stream.
+     */
+    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(pcg_engine, boost::uint64_t, x0)
+    { set_state(state_type(x0)); }
+
+    /**
+     * Selects @c stream and sets the state for the seed @c x0.
+     * Only available when the stream can be set.
+     */
+    void seed(boost::uint64_t x0, const stream_type& stream)
+    {
+        set_stream(stream);
+        seed(x0);
+    }
+
+    /**
+     * Seeds a @c pcg_engine using values from a SeedSeq.  When the
+     * stream can be set, the stream is taken from the same values.
+     */
+    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(pcg_engine, SeedSeq, seq)
+    {
+        boost::uint_least32_t storage[2 * words];
+        const std::size_t n = is_setseq::value ? 2 * words : words;
+        seq.generate(&storage[0], &storage[0] + n);
+        if(is_setseq::value) {
+            set_increment(make_state(storage));
+            set_state(make_state(storage + words));
+        } else {
+            set_state(make_state(storage));
+        }
+    }
+
+    /**
+     * seeds a @c pcg_engine with values taken from the itrator range
+     * [first, last) and adjusts @c first to point to the element after
+     * the last one used.  The state is taken from the first 32-bit
+     * values, followed by the stream when it can be set.  If there are
+     * not enough elements, throws @c std::invalid_argument.
+     *
+     * @c first and @c last must be input iterators.
+     */
+    template<class It>
+    void seed(It& first, It last,
+              typename boost::disable_if<boost::is_arithmetic<It> >::type* = 0)
+    {
+        boost::uint_least32_t storage[2 * words];
+        const std::size_t n = is_setseq::value ? 2 * words : words;
+        for(std::size_t j = 0; j < n; ++j) {
+            if(first == last) {
+                boost::throw_exception(std::invalid_argument("Not enough elements in call to seed."));
+            }
+            storage[j] = static_cast<boost::uint_least32_t>(*first++ & 0xFFFFFFFFu);
+        }
+        if(is_setseq::value) {
+            set_increment(make_state(storage + words));
+        }
+        set_state(make_state(storage));
+    }
+
+    /**
+     * Selects one of the streams of the generator without changing
+     * the state.  Only available when the stream can be set.
+     */
+    void set_stream(const stream_type& stream)
+    {
+        BOOST_STATIC_ASSERT_MSG(is_setseq::value, "the stream of this pcg_engine is fixed");
+        set_increment((stream << 1) | state_type(1));
+    }
+
+    /** Returns the current stream. */
+    stream_type stream() const { return this->increment() >> 1; }
+
+    /**
+     * Returns the smallest value that the @c pcg_engine can produce.
+     */
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return 0; }
+    /**
+     * Returns the largest value that the @c pcg_engine can produce.
+     */
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return (std::numeric_limits<result_type>::max)(); }
+
+    /** Returns the next value of the @c pcg_engine. */
+    result_type operator()()
+    {
+        const state_type old = _state;
+        _state = _state * multiplier() + this->increment();
+        return Output::apply(Output::output_previous ? old : _state);
+    }
+
+    /** Fills a range with random values */
+    template<class Iter>
+    void generate(Iter first, Iter last)
+    {
+        for(; first != last; ++first) {
+            *first = (*this)();
+        }
+    }
+
+    /**
+     * Advances the state of the generator by @c z in O(log z) steps,
+     * using the algorithm of
+     *
+     *  @blockquote
+     *  "Random Number Generation with Arbitrary Strides", F. B. Brown,
+     *  Transactions of the American Nuclear Society 71, 1994
+     *  @endblockquote
+     */
+    void discard(boost::uintmax_t z)
+    {
+        state_type acc_mult = 1;
+        state_type acc_plus = 0;
+        state_type cur_mult = multiplier();
+        state_type cur_plus = this->increment();
+        while(z != 0) {
+            if(z & 1) {
+                acc_mult = acc_mult * cur_mult;
+                acc_plus = acc_plus * cur_mult + cur_plus;
+            }
+            cur_plus = (cur_mult + 1) * cur_plus;
+            cur_mult = cur_mult * cur_mult;
+            z >>= 1;
+        }
+        _state = acc_mult * _state + acc_plus;
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    friend bool operator==(const pcg_engine& x, const pcg_engine& y)
+    { return x._state == y._state && x.increment() == y.increment(); }
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    friend bool operator!=(const pcg_engine& x, const pcg_engine& y)
+    { return !(x == y); }
+
+#if !defined(BOOST_RANDOM_NO_STREAM_OPERATORS)
+    /**
+     * Writes a @c pcg_engine to a @c std::ostream.  The increment
+     * follows the state when the stream can be set.
+     */
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT,Traits>&
+    operator<<(std::basic_ostream<CharT,Traits>& os, const pcg_engine& pcg)
+    {
+        detail::pcg_write(os, pcg._state);
+        if(is_setseq::value) {
+            os << ' ';
+            detail::pcg_write(os, pcg.increment());
+        }
+        return os;
+    }
+
+    /** Reads a @c pcg_engine from a @c std::istream. */
+    template<class CharT, class Traits>
+    friend std::basic_istream<CharT,Traits>&
+    operator>>(std::basic_istream<CharT,Traits>& is, pcg_engine& pcg)
+    {
+        pcg.read(is);
+        return is;
+    }
+#endif
+
+private:
+
+    /// \cond show_private
+
+    typedef boost::is_same<Stream, detail::pcg_setseq_stream> is_setseq;
+    typedef boost::is_same<Stream, detail::pcg_mcg_stream> is_mcg;
+
+    // the number of 32-bit values in the state
+    BOOST_STATIC_CONSTANT(std::size_t, words = sizeof(state_type) / 4);
+
+    static state_type multiplier() { return detail::pcg_default<state_type>::multiplier(); }
+
+    static state_type make_state(const boost::uint_least32_t* storage)
+    {
+        state_type result = 0;
+        for(std::size_t j = 0; j < words; ++j) {
+            result = result | (state_type(static_cast<boost::uint64_t>(storage[j])) << static_cast<int>(32 * j));
+        }
+        return result;
+    }
+
+    void set_state(const state_type& x)
+    {
+        if(is_mcg::value) {
+            // the state of a multiplicative generator must be odd
+            _state = x | state_type(3);
+        } else {
+            _state = (x + this->increment()) * multiplier() + this->increment();
+        }
+    }
+
+    void set_increment(const state_type& inc)
+    { set_increment(inc, typename is_setseq::type()); }
+    void set_increment(const state_type& inc, boost::true_type)
+    { this->_inc = inc | state_type(1); }
+    void set_increment(const state_type&, boost::false_type) {}
+
+    template<class CharT, class Traits>
+    void read(std::basic_istream<CharT, Traits>& is)
+    {
+        state_type x = 0;
+        state_type inc = this->increment();
+        detail::pcg_read(is, x);
+        if(is && is_setseq::value) {
+            is >> std::ws;
+            detail::pcg_read(is, inc);
+        }
+        if(is) {
+            if(is_setseq::value ? (inc & state_type(1)) == state_type(0)
+                                : is_mcg::value && (x & state_type(1)) == state_type(0)) {
+                is.setstate(std::ios_base::failbit);
+            } else {
+                _state = x;
+                if(is_setseq::value) {
+                    set_increment(inc);
+                }
+            }
+        }
+    }
+
+    /// \endcond
+
+    state_type _state;
+};
+
+#ifndef BOOST_NO_INCLASS_MEMBER_INITIALIZATION
+//  A definition is required even for integral static constants
+template<class Output, class Stream>
+const bool pcg_engine<Output, Stream>::has_fixed_range;
+template<class Output, class Stream>
+const boost::uint64_t pcg_engine<Output, Stream>::default_seed;
+template<class Output, class Stream>
+const std::size_t pcg_engine<Output, Stream>::words;
+#endif
+
+/**
+ * 32-bit outputs from 64-bit state with a selectable stream: the
+ * generator called pcg32 by the reference implementation.
+ */
+typedef pcg_engine<detail::pcg_xsh_rr_64_32, detail::pcg_setseq_stream> pcg32;
+
+/** As @c pcg32, with a fixed stream and 8 bytes of state. */
+typedef pcg_engine<detail::pcg_xsh_rr_64_32, detail::pcg_oneseq_stream> pcg32_oneseq;
+
+/**
+ * 32-bit outputs from a 64-bit multiplicative generator, with a
+ * cheaper output permutation.  The period is 2^62.
+ */
+typedef pcg_engine<detail::pcg_xsh_rs_64_32, detail::pcg_mcg_stream> pcg32_fast;
+
+/**
+ * 64-bit outputs from 128-bit state with a selectable stream: the
+ * generator called pcg64 by the reference implementation.
+ */
+typedef pcg_engine<detail::pcg_xsl_rr_128_64, detail::pcg_setseq_stream> pcg64;
+
+/** As @c pcg64, with a fixed stream and 16 bytes of state. */
+typedef pcg_engine<detail::pcg_xsl_rr_128_64, detail::pcg_oneseq_stream> pcg64_oneseq;
+
+/**
+ * 64-bit outputs from a 128-bit multiplicative generator.
+ * The period is 2^126.
+ */
+typedef pcg_engine<detail::pcg_xsl_rr_128_64, detail::pcg_mcg_stream> pcg64_fast;
+
+} // namespace random
+} // namespace boost
+
+#include <boost/random/detail/enable_warnings.hpp>
+
+#endif // BOOST_RANDOM_PCG_HPP
@@ -0,0 +1,597 @@
+/* boost random/philox.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_PHILOX_HPP
+#define BOOST_RANDOM_PHILOX_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/random/detail/config.hpp>
+#include <boost/random/detail/large_arithmetic.hpp>
+#include <boost/random/detail/operators.hpp>
+#include <boost/random/detail/seed.hpp>
+#include <boost/random/detail/seed_impl.hpp>
+#include <boost/random/detail/simd.hpp>
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+// Splits the interleaved constants of philox_engine into the
+// multipliers (even positions) and the round constants (odd positions).
+template<class UIntType, UIntType... consts>
+struct philox_constants;
+
+template<class UIntType, UIntType m0, UIntType c0>
+struct philox_constants<UIntType, m0, c0>
+{
+    static constexpr std::array<UIntType, 1> multipliers() { return {{ m0 }}; }
+    static constexpr std::array<UIntType, 1> round_consts() { return {{ c0 }}; }
+};
+
+template<class UIntType, UIntType m0, UIntType c0, UIntType m1, UIntType c1>
+struct philox_constants<UIntType, m0, c0, m1, c1>
+{
+    static constexpr std::array<UIntType, 2> multipliers() { return {{ m0, m1 }}; }
+    static constexpr std::array<UIntType, 2> round_consts() { return {{ c0, c1 }}; }
+};
+
+// The low w bits of the 2w-bit product a*b; the high w bits go to hi.
+template<std::size_t w, class UIntType>
+inline UIntType philox_mulhilo(UIntType a, UIntType b, UIntType& hi, std::true_type)
+{
+    const boost::uint64_t product = static_cast<boost::uint64_t>(a) * b;
+    hi = static_cast<UIntType>(product >> w);
+    return static_cast<UIntType>(product & ((boost::uint64_t(1) << w) - 1));
+}
+
+template<std::size_t w, class UIntType>
+inline UIntType philox_mulhilo(UIntType a, UIntType b, UIntType& hi, std::false_type)
+{
+    boost::uint64_t high;
+    const boost::uint64_t low = detail::umul128(a, b, high);
+    hi = static_cast<UIntType>((high << (64 - w)) | (low >> (w - 1) >> 1));
+    return static_cast<UIntType>(low & (~boost::uint64_t(0) >> (64 - w)));
+}
+
+} // namespace detail
+
+/**
+ * Instantiations of class template philox_engine model a
+ * \pseudo_random_number_generator.  Philox is a counter-based
+ * generator described in
+ *
+ *  @blockquote
+ *  "Parallel random numbers: as easy as 1, 2, 3", John K. Salmon,
+ *  Mark A. Moraes, Ron O. Dror, and David E. Shaw, Proceedings of
+ *  the International Conference for High Performance Computing,
+ *  Networking, Storage and Analysis (SC '11), 2011.
+ *  @endblockquote
+ *
+ * Each block of n outputs is a keyed bijection of an (n*w)-bit
+ * counter, so the state is just the key and the counter.
+ * @c discard is O(1), and any output of any stream can be computed
+ * directly with @c set_key and @c set_counter, or with the static
+ * function @c block, without any shared state.  The interface
+ * follows @c std::philox_engine from C++26.
+ *
+ * The template parameter consts holds n values: the multipliers
+ * at even positions and the round constants at odd positions.
+ *
+ * When w is 32, @c generate() computes several blocks at a time with
+ * SSE2, AVX2 or AVX-512 instructions if the translation unit is
+ * compiled for them.  The output is identical to the scalar code.
+ */
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r,
+         UIntType... consts>
+class philox_engine
+{
+    static_assert(n == 2 || n == 4, "philox_engine requires n == 2 or n == 4");
+    static_assert(sizeof...(consts) == n, "philox_engine requires n constants");
+    static_assert(r > 0, "philox_engine requires at least one round");
+    static_assert(w > 0 && w <= 64 && w <= std::numeric_limits<UIntType>::digits,
+                  "philox_engine requires 0 < w <= 64 bits of UIntType");
+
+    static constexpr std::size_t array_size = n / 2;
+    static constexpr UIntType mask =
+        (~static_cast<UIntType>(0)) >> (std::numeric_limits<UIntType>::digits - w);
+
+public:
+    typedef UIntType result_type;
+
+    static constexpr std::size_t word_size = w;
+    static constexpr std::size_t word_count = n;
+    static constexpr std::size_t round_count = r;
+    static constexpr std::array<result_type, n / 2> multipliers =
+        detail::philox_constants<UIntType, consts...>::multipliers();
+    static constexpr std::array<result_type, n / 2> round_consts =
+        detail::philox_constants<UIntType, consts...>::round_consts();
+    static constexpr result_type default_seed = 20111115u;
+
+    // Required for old Boost.Random concept
+    static constexpr bool has_fixed_range = false;
+
+    /** The key of a stream, as taken by @c set_key. */
+    typedef std::array<result_type, array_size> key_type;
+    /** A counter, most significant word first, as taken by @c set_counter. */
+    typedef std::array<result_type, n> counter_type;
+
+    /**
+     * Returns the smallest value that the generator can produce.
+     */
+    static constexpr result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return 0; }
+    /**
+     * Returns the largest value that the generator can produce.
+     */
+    static constexpr result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+    { return mask; }
+
+    /** Constructs a @c philox_engine and calls @c seed(). */
+    philox_engine() { seed(); }
+
+    /** Constructs a @c philox_engine and calls @c seed(value). */
+    BOOST_RANDOM_DETAIL_ARITHMETIC_CONSTRUCTOR(philox_engine, result_type, value)
+    { seed(value); }
+
+    /** Constructs a @c philox_engine and calls @c seed(seq). */
+    BOOST_RANDOM_DETAIL_SEED_SEQ_CONSTRUCTOR(philox_engine, SeedSeq, seq)
+    { seed(seq); }
+
+    /**
+     * Constructs a @c philox_engine and calls @c seed(first, last).
+     */
+    template<class It>
+    philox_engine(It& first, It last) { seed(first, last); }
+
+    // compiler-generated copy ctor and assignment operator are fine
+
+    /** Calls @c seed(default_seed). */
+    void seed() { seed(default_seed); }
+
+    /**
+     * Sets the key to (value mod 2^w, 0, ...) and the counter to zero.
+     */
+    BOOST_RANDOM_DETAIL_ARITHMETIC_SEED(philox_engine, result_type, value)
+    {
+        _key[0] = value & mask;
+        for(std::size_t j = 1; j < array_size; ++j) {
+            _key[j] = 0;
+        }
+        reset_counter();
+    }
+
+    /**
+     * Sets the key from ceil(w/32) 32-bit values per key word produced
+     * by @c seq.generate(), and the counter to zero.
+     */
+    BOOST_RANDOM_DETAIL_SEED_SEQ_SEED(philox_engine, SeedSeq, seq)
+    {
+        detail::seed_array_int<w>(seq, _key);
+        reset_counter();
+    }
+
+    /**
+     * Sets the key from values taken from the iterator range
+     * [first, last) and adjusts @c first to point to the element
+     * after the last one used.  The counter is set to zero.  If there
+     * are not enough elements, throws @c std::invalid_argument.
+     */
+    template<class It>
+    void seed(It& first, It last)
+    {
+        detail::fill_array_int<w>(first, last, _key);
+        reset_counter();
+    }
+
+    /**
+     * Sets the key, so that each key selects an independent stream,
+     * and the counter to zero.
+     */
+    void set_key(const key_type& key)
+    {
+        for(std::size_t j = 0; j < array_size; ++j) {
+            _key[j] = key[j] & mask;
+        }
+        reset_counter();
+    }
+
+    /**
+     * Sets the counter.  counter[n-1] is the least significant word.
+     * The next n values are the block computed from this counter.
+     */
+    void set_counter(const counter_type& counter)
+    {
+        for(std::size_t j = 0; j < n; ++j) {
+            _counter[j] = counter[n - 1 - j] & mask;
+        }
+        _index = n - 1;
+    }
+
+    /**
+     * Returns the n values produced by a generator after
+     * @c set_key(key) and @c set_counter(counter).
+     */
+    static counter_type block(const key_type& key, const counter_type& counter)
+    {
+        result_type k[array_size];
+        result_type x[n];
+        for(std::size_t j = 0; j < array_size; ++j) {
+            k[j] = key[j] & mask;
+        }
+        for(std::size_t j = 0; j < n; ++j) {
+            x[j] = counter[n - 1 - j] & mask;
+        }
+        counter_type result;
+        philox(k, x, result.data());
+        return result;
+    }
+
+    /** Returns the next value of the generator. */
+    result_type operator()()
+    {
+        if(++_index == n) {
+            philox(_key, _counter, _output);
+            increment(1);
+            _index = 0;
+        }
+        return _output[_index];
+    }
+
+    /** Fills a range with random values. */
+    template<class Iter>
+    void generate(Iter first, Iter last)
+    {
+        // finish the current block, then produce whole blocks
+        for(; first != last && _index != n - 1; ++first) {
+            *first = (*this)();
+        }
+        const std::size_t blocks =
+            static_cast<std::size_t>(std::distance(first, last)) / n;
+        first = generate_blocks(first, blocks);
+        for(; first != last; ++first) {
+            *first = (*this)();
+        }
+    }
+
+    /** Advances the state of the generator by @c z. */
+    void discard(boost::uintmax_t z)
+    {
+        const boost::uintmax_t offset = z % n + _index;
+        const boost::uintmax_t blocks = z / n + offset / n;
+        if(blocks != 0) {
+            increment(blocks - 1);
+            philox(_key, _counter, _output);
+            increment(1);
+        }
+        _index = static_cast<std::size_t>(offset % n);
+    }
+
+    /**
+     * Writes the key, the counter, and the position in the
+     * current block to a @c std::ostream.
+     */
+    BOOST_RANDOM_DETAIL_OSTREAM_OPERATOR(os, philox_engine, ph)
+    {
+        for(std::size_t j = 0; j < array_size; ++j) {
+            os << ph._key[j] << ' ';
+        }
+        for(std::size_t j = 0; j < n; ++j) {
+            os << ph._counter[j] << ' ';
+        }
+        os << ph._index;
+        return os;
+    }
+
+    /**
+     * Reads a @c philox_engine from a @c std::istream.
+     */
+    BOOST_RANDOM_DETAIL_ISTREAM_OPERATOR(is, philox_engine, ph)
+    {
+        philox_engine tmp;
+        for(std::size_t j = 0; j < array_size; ++j) {
+            is >> tmp._key[j] >> std::ws;
+        }
+        for(std::size_t j = 0; j < n; ++j) {
+            is >> tmp._counter[j] >> std::ws;
+        }
+        is >> tmp._index;
+        if(!is) {
+            return is;
+        }
+        if(tmp._index >= n) {
+            is.setstate(std::ios_base::failbit);
+            return is;
+        }
+        for(std::size_t j = 0; j < array_size; ++j) {
+            tmp._key[j] &= mask;
+        }
+        for(std::size_t j = 0; j < n; ++j) {
+            tmp._counter[j] &= mask;
+        }
+        // the current block came from the previous counter
+        if(tmp._index != n - 1) {
+            result_type prev[n];
+            bool borrow = true;
+            for(std::size_t j = 0; j < n; ++j) {
+                prev[j] = (tmp._counter[j] - borrow) & mask;
+                borrow = borrow && tmp._counter[j] == 0;
+            }
+            philox(tmp._key, prev, tmp._output);
+        }
+        ph = tmp;
+        return is;
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    BOOST_RANDOM_DETAIL_EQUALITY_OPERATOR(philox_engine, x, y)
+    {
+        for(std::size_t j = 0; j < array_size; ++j) {
+            if(x._key[j] != y._key[j]) return false;
+        }
+        for(std::size_t j = 0; j < n; ++j) {
+            if(x._counter[j] != y._counter[j]) return false;
+        }
+        return x._index == y._index;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    BOOST_RANDOM_DETAIL_INEQUALITY_OPERATOR(philox_engine)
+
+private:
+    /// \cond show_private
+
+    // The vector type used by generate(), or simd_none.
+    typedef typename std::conditional<w == 32,
+        typename detail::simd_select_word<std::uint64_t>::type,
+        detail::simd_none>::type simd_type;
+
+    typedef std::integral_constant<bool, (w <= 32)> narrow_words;
+
+    void reset_counter()
+    {
+        for(std::size_t j = 0; j < n; ++j) {
+            _counter[j] = 0;
+        }
+        _index = n - 1;
+    }
+
+    /** Adds z to the (n*w)-bit counter. */
+    void increment(boost::uintmax_t z)
+    {
+        for(std::size_t j = 0; j < n && z != 0; ++j) {
+            const result_type add = static_cast<result_type>(z & mask);
+            const result_type sum = (_counter[j] + add) & mask;
+            z = (z >> (w - 1) >> 1) + (sum < add ? 1 : 0);
+            _counter[j] = sum;
+        }
+    }
+
+    static constexpr std::size_t permute(std::size_t j)
+    { return n == 4 && j % 2 == 0 ? 2 - j : j; }
+
+    /** Computes the block for the counter under the key. */
+    static void philox(const result_type* key, const result_type* counter,
+                       result_type* out)
+    { philox(key, counter, out, std::integral_constant<std::size_t, n>()); }
+
+    // The rounds are written out so that the words stay in registers.
+    static void philox(const result_type* key, const result_type* counter,
+                       result_type* out, std::integral_constant<std::size_t, 4>)
+    {
+        const result_type m0 = multipliers[0];
+        const result_type m1 = multipliers[1];
+        result_type x0 = counter[0], x1 = counter[1], x2 = counter[2], x3 = counter[3];
+        result_type k0 = key[0], k1 = key[1];
+        for(std::size_t q = 0; q < r; ++q) {
+            result_type hi0, hi1;
+            const result_type lo0 = detail::philox_mulhilo<w>(x2, m0, hi0, narrow_words());
+            const result_type lo1 = detail::philox_mulhilo<w>(x0, m1, hi1, narrow_words());
+            x0 = hi0 ^ k0 ^ x1;
+            x1 = lo0;
+            x2 = hi1 ^ k1 ^ x3;
+            x3 = lo1;
+            k0 = (k0 + round_consts[0]) & mask;
+            k1 = (k1 + round_consts[1]) & mask;
+        }
+        out[0] = x0;
+        out[1] = x1;
+        out[2] = x2;
+        out[3] = x3;
+    }
+
+    static void philox(const result_type* key, const result_type* counter,
+                       result_type* out, std::integral_constant<std::size_t, 2>)
+    {
+        const result_type m0 = multipliers[0];
+        result_type x0 = counter[0], x1 = counter[1];
+        result_type k0 = key[0];
+        for(std::size_t q = 0; q < r; ++q) {
+            result_type hi;
+            const result_type lo = detail::philox_mulhilo<w>(x0, m0, hi, narrow_words());
+            x0 = hi ^ k0 ^ x1;
+            x1 = lo;
+            k0 = (k0 + round_consts[0]) & mask;
+        }
+        out[0] = x0;
+        out[1] = x1;
+    }
+
+    /** Writes whole blocks directly into an array of result_type. */
+    result_type* generate_blocks(result_type* out, std::size_t blocks)
+    {
+        std::size_t b = generate_blocks_simd(out, blocks, simd_type());
+        for(; b < blocks; ++b) {
+            philox(_key, _counter, out + b*n);
+            increment(1);
+        }
+        return out + blocks*n;
+    }
+
+    /** Writes whole blocks through a buffer. */
+    template<class Iter>
+    Iter generate_blocks(Iter first, std::size_t blocks)
+    {
+        static const std::size_t buffer_blocks = 16;
+        result_type buffer[buffer_blocks * n];
+        while(blocks != 0) {
+            const std::size_t count = blocks < buffer_blocks ? blocks : buffer_blocks;
+            generate_blocks(&buffer[0], count);
+            for(std::size_t j = 0; j < count * n; ++j, ++first) {
+                *first = buffer[j];
+            }
+            blocks -= count;
+        }
+        return first;
+    }
+
+    /**
+     * Computes V::width blocks at a time, one block per 64-bit lane.
+     * Each lane holds a 32-bit word, so the multiply is a single
+     * 32x32->64 bit product.  Returns the number of blocks written.
+     */
+    template<class V>
+    std::size_t generate_blocks_simd(result_type* out, std::size_t blocks, V)
+    {
+        typedef typename V::type vec;
+        const std::size_t lanes = V::width;
+        std::uint64_t round_keys[r][array_size];
+        for(std::size_t j = 0; j < array_size; ++j) {
+            result_type k = _key[j];
+            for(std::size_t q = 0; q < r; ++q) {
+                round_keys[q][j] = k;
+                k = (k + round_consts[j]) & mask;
+            }
+        }
+        const vec low = V::set1(0xFFFFFFFFu);
+        std::uint64_t offsets[lanes];
+        for(std::size_t l = 0; l < lanes; ++l) {
+            offsets[l] = l;
+        }
+        const vec lane_offsets = V::load(offsets);
+        std::size_t b = 0;
+        for(; b + lanes <= blocks; b += lanes) {
+            std::uint64_t buf[n][lanes];
+            vec x[n];
+            if(_counter[0] <= mask - lanes) {
+                // no carry out of the low word within this batch
+                x[0] = V::add(V::set1(_counter[0]), lane_offsets);
+                for(std::size_t j = 1; j < n; ++j) {
+                    x[j] = V::set1(_counter[j]);
+                }
+                _counter[0] += lanes;
+            } else {
+                for(std::size_t l = 0; l < lanes; ++l) {
+                    for(std::size_t j = 0; j < n; ++j) {
+                        buf[j][l] = _counter[j];
+                    }
+                    increment(1);
+                }
+                for(std::size_t j = 0; j < n; ++j) {
+                    x[j] = V::load(buf[j]);
+                }
+            }
+            for(std::size_t q = 0; q < r; ++q) {
+                vec v[n];
+                for(std::size_t j = 0; j < n; ++j) {
+                    v[j] = x[permute(j)];
+                }
+                for(std::size_t j = 0; j < array_size; ++j) {
+                    const vec p = V::mul32(v[2*j], V::set1(multipliers[j]));
+                    x[2*j] = V::bxor(V::bxor(V::template shr<32>(p),
+                                             V::set1(round_keys[q][j])),
+                                     v[2*j + 1]);
+                    x[2*j + 1] = V::band(p, low);
+                }
+            }
+            for(std::size_t j = 0; j < n; ++j) {
+                V::store(buf[j], x[j]);
+            }
+            for(std::size_t l = 0; l < lanes; ++l) {
+                for(std::size_t j = 0; j < n; ++j) {
+                    out[(b + l)*n + j] = static_cast<result_type>(buf[j][l]);
+                }
+            }
+        }
+        return b;
+    }
+
+    std::size_t generate_blocks_simd(result_type*, std::size_t, detail::simd_none)
+    { return 0; }
+
+    /// \endcond
+
+    result_type _key[array_size];
+    result_type _counter[n];    // least significant word first
+    result_type _output[n];
+    std::size_t _index;
+};
+
+#ifdef BOOST_NO_CXX17_INLINE_VARIABLES
+//  A definition is required for odr-used static constexpr members
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr std::size_t philox_engine<UIntType, w, n, r, consts...>::word_size;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr std::size_t philox_engine<UIntType, w, n, r, consts...>::word_count;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr std::size_t philox_engine<UIntType, w, n, r, consts...>::round_count;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr std::array<UIntType, n / 2> philox_engine<UIntType, w, n, r, consts...>::multipliers;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr std::array<UIntType, n / 2> philox_engine<UIntType, w, n, r, consts...>::round_consts;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr UIntType philox_engine<UIntType, w, n, r, consts...>::default_seed;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr bool philox_engine<UIntType, w, n, r, consts...>::has_fixed_range;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+constexpr UIntType philox_engine<UIntType, w, n, r, consts...>::mask;
+#endif
+
+/**
+ * The 4x32 variant of Philox with 10 rounds, as @c std::philox4x32.
+ * The 10000th value of a default constructed generator is 1955073260.
+ */
+typedef philox_engine<boost::uint_fast32_t, 32, 4, 10,
+    0xCD9E8D57, 0x9E3779B9, 0xD2511F53, 0xBB67AE85> philox4x32;
+
+/**
+ * The 4x64 variant of Philox with 10 rounds, as @c std::philox4x64.
+ * The 10000th value of a default constructed generator is
+ * 3409172418970261260.
+ */
+typedef philox_engine<boost::uint_fast64_t, 64, 4, 10,
+    UINT64_C(0xCA5A826395121157), UINT64_C(0x9E3779B97F4A7C15),
+    UINT64_C(0xD2E7470EE14C6C93), UINT64_C(0xBB67AE8584CAA73B)> philox4x64;
+
+} // namespace random
+
+using random::philox4x32;
+using random::philox4x64;
+
+} // namespace boost
+
+#endif // BOOST_RANDOM_PHILOX_HPP
@@ -18,6 +18,7 @@
 #ifndef BOOST_RANDOM_RANDOM_DEVICE_HPP
 #define BOOST_RANDOM_RANDOM_DEVICE_HPP
 
+#include <cstddef>
 #include <string>
 #include <boost/config.hpp>
 #include <boost/noncopyable.hpp>
@@ -62,6 +63,12 @@ namespace random {
  * pseudo-device, which blocks on reads if the entropy pool has no more
  * random bits available.
  *
+ * When the token is the default, /dev/urandom, and the kernel supports
+ * it, the getrandom() system call is used instead of opening the
+ * pseudo-device.  It reads from the same pool without a file descriptor,
+ * but blocks until the pool has been initialized at boot.  Defining
+ * BOOST_RANDOM_NO_GETRANDOM when building the library disables it.
+ *
  * <b>Implementation Note for Windows</b>
  *
  * On the Windows operating system, token is interpreted as the name
@@ -85,6 +92,11 @@ namespace random {
  * </table>
  *
  * The measurement error is estimated at +/- 1 usec.
+ *
+ * Every call to operator() is a request to the operating system.
+ * @c generate requests a whole range at once, and a \random_device
+ * constructed with a buffer size reads that many values ahead, so that
+ * most calls to operator() are served from memory.
  */
 class random_device : private noncopyable
 {
@@ -105,6 +117,19 @@ public:
      * service for monitoring a stochastic process. 
      */
     BOOST_RANDOM_DECL explicit random_device(const std::string& token);
+    /**
+     * Constructs a @c random_device using the default device, which
+     * reads @c buffer_size values at a time and returns them from
+     * operator() one by one.  The values are read from the device
+     * before they are needed, so a buffered \random_device should not
+     * be used where that matters, for instance across a fork().
+     */
+    BOOST_RANDOM_DECL explicit random_device(std::size_t buffer_size);
+    /**
+     * Constructs a @c random_device using the given token, which reads
+     * @c buffer_size values at a time.
+     */
+    BOOST_RANDOM_DECL random_device(const std::string& token, std::size_t buffer_size);
 
     BOOST_RANDOM_DECL ~random_device();
 
@@ -120,16 +145,35 @@ public:
     /** Returns a random value in the range [min, max]. */
     BOOST_RANDOM_DECL unsigned int operator()();
 
-    /** Fills a range with random 32-bit values. */
+    /**
+     * Fills a range with random 32-bit values, requesting up to 256
+     * values from the device at a time.
+     */
     template<class Iter>
     void generate(Iter begin, Iter end)
     {
-        for(; begin != end; ++begin) {
-            *begin = (*this)();
+        unsigned int buffer[256];
+        while(begin != end) {
+            std::size_t n = 0;
+            for(Iter iter = begin; n < 256 && iter != end; ++iter) {
+                ++n;
+            }
+            fill(buffer, n);
+            for(std::size_t i = 0; i < n; ++i, ++begin) {
+                *begin = buffer[i];
+            }
         }
     }
 
+    /** Fills a contiguous range with one request to the device. */
+    void generate(unsigned int* begin, unsigned int* end)
+    {
+        fill(begin, static_cast<std::size_t>(end - begin));
+    }
+
 private:
+    BOOST_RANDOM_DECL void fill(unsigned int* first, std::size_t n);
+
     class impl;
     impl * pimpl;
 };
@@ -0,0 +1,334 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_ROMU_HPP
+#define BOOST_RANDOM_ROMU_HPP
+
+#include <boost/random/splitmix64.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/core/bit.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <ios>
+#include <istream>
+#include <type_traits>
+#include <iterator>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// N is the number of 64-bit state words.  Derived provides
+// static std::uint64_t step(std::array<std::uint64_t, N>&).
+template <typename Derived, std::size_t N>
+class romu_base
+{
+protected:
+
+    std::array<std::uint64_t, N> state_;
+
+private:
+
+    static inline std::uint64_t concatenate(std::uint32_t word1, std::uint32_t word2) noexcept
+    {
+        return static_cast<std::uint64_t>(word1) << 32U | word2;
+    }
+
+public:
+
+    using result_type = std::uint64_t;
+    using seed_type = std::uint64_t;
+
+    static constexpr bool has_fixed_range {false};
+
+    /** Seeds the generator using the default seed of boost::random::splitmix64 */
+    void seed()
+    {
+        splitmix64 gen;
+        for (auto& i : state_)
+        {
+            i = gen();
+        }
+    }
+
+    /** Seeds the generator with a user provided seed. */
+    void seed(const seed_type value)
+    {
+        splitmix64 gen(value);
+        for (auto& i : state_)
+        {
+            i = gen();
+        }
+    }
+
+    /**
+     * Seeds the generator with 32-bit values produced by @c seq.generate().
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    void seed(Sseq& seq)
+    {
+        std::array<std::uint32_t, N * 2> seeds;
+        seq.generate(seeds.begin(), seeds.end());
+
+        for (std::size_t i = 0; i < state_.size(); ++i)
+        {
+            state_[i] = concatenate(seeds[2*i], seeds[2*i + 1]);
+        }
+    }
+
+    /**
+     * Sets the state of the generator using values from an iterator range.
+     * The state must not be everywhere zero.
+     */
+    template <typename FIter>
+    void seed(FIter first, FIter last)
+    {
+        static_assert(std::is_integral<typename std::iterator_traits<FIter>::value_type>::value,
+                      "Value type must be a built-in integer type" );
+
+        std::size_t offset = 0;
+        while (first != last && offset < state_.size())
+        {
+            state_[offset++] = static_cast<seed_type>(*first++);
+        }
+
+        if (offset != state_.size())
+        {
+            boost::throw_exception(std::invalid_argument("Not enough elements in call to seed."));
+        }
+    }
+
+    /**
+     * Constructs a @c romu generator and calls @c seed().
+     */
+    romu_base() { seed(); }
+
+    /** Seeds the generator with a user provided seed. */
+    explicit romu_base(const seed_type value)
+    {
+        seed(value);
+    }
+
+    template <typename FIter>
+    romu_base(FIter& first, FIter last) { seed(first, last); }
+
+    /**
+     * Seeds the generator with 32-bit values produced by @c seq.generate().
+     *
+     * @xmlnote
+     * The copy constructor will always be preferred over
+     * the templated constructor.
+     * @endxmlnote
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, romu_base>::value, bool>::type = true>
+    explicit romu_base(Sseq& seq)
+    {
+        seed(seq);
+    }
+
+    /**  Returns the next value of the generator. */
+    inline result_type next() noexcept
+    {
+        return Derived::step(state_);
+    }
+
+    /**  Returns the next value of the generator. */
+    inline result_type operator()() noexcept
+    {
+        return next();
+    }
+
+    /**
+     * Advances the state of the generator by @c z.  The transition
+     * function is not linear, so this takes O(z) time.
+     */
+    inline void discard(const std::uint64_t z) noexcept
+    {
+        std::array<std::uint64_t, N> s = state_;
+        for (std::uint64_t i {}; i < z; ++i)
+        {
+            Derived::step(s);
+        }
+        state_ = s;
+    }
+
+    /**
+     * Fills a range with random values.  The state is kept in locals for
+     * the whole range so that stores to the output do not force it back
+     * to memory on every step.
+     */
+    template <typename FIter>
+    inline void generate(FIter first, FIter last) noexcept
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        std::array<std::uint64_t, N> s = state_;
+        while (first != last)
+        {
+            *first++ = static_cast<iter_type>(Derived::step(s));
+        }
+        state_ = s;
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    inline friend bool operator==(const romu_base& lhs, const romu_base& rhs) noexcept
+    {
+        return lhs.state_ == rhs.state_;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    inline friend bool operator!=(const romu_base& lhs, const romu_base& rhs) noexcept
+    {
+        return lhs.state_ != rhs.state_;
+    }
+
+    /**  Writes a @c romu generator to a @c std::ostream. */
+    template <typename CharT, typename Traits>
+    inline friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& ost,
+                                                                const romu_base& e)
+    {
+        for (std::size_t i {}; i < e.state_.size(); ++i)
+        {
+            ost << e.state_[i] << ' ';
+        }
+
+        return ost;
+    }
+
+    /**  Reads a @c romu generator from a @c std::istream. */
+    template <typename CharT, typename Traits>
+    inline friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& ist,
+                                                                romu_base& e)
+    {
+        for (std::size_t i {}; i < e.state_.size(); ++i)
+        {
+            ist >> e.state_[i] >> std::ws;
+        }
+
+        return ist;
+    }
+
+    /**
+     * Returns the largest value that the generator can produce.
+     */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    /**
+     * Returns the smallest value that the generator can produce.
+     */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<result_type>::min)();
+    }
+
+    inline std::array<std::uint64_t, N> state() const noexcept
+    {
+        return state_;
+    }
+};
+
+} // namespace detail
+
+/**
+ * This is RomuDuo from Mark A. Overton's Romu family of nonlinear
+ * multiply-rotate generators (https://www.romu-random.org).  It has
+ * 128 bits of state and passes all tests we are aware of.  Romu
+ * generators do not have a single period; the paper bounds the
+ * probability of a short cycle for a random seed.
+ */
+class romu_duo final : public detail::romu_base<romu_duo, 2>
+{
+private:
+
+    using Base = detail::romu_base<romu_duo, 2>;
+    friend Base;
+
+    static inline std::uint64_t step(std::array<std::uint64_t, 2>& s) noexcept
+    {
+        const std::uint64_t xp = s[0];
+        s[0] = UINT64_C(15241094284759029579) * s[1];
+        s[1] = boost::core::rotl(s[1], 36) + boost::core::rotl(s[1], 15) - xp;
+        return xp;
+    }
+
+public:
+
+    using Base::Base;
+};
+
+/**
+ * This is RomuDuoJr, the fastest member of the Romu family.  It has
+ * 128 bits of state and is intended for applications that draw fewer
+ * than 2^51 values from each generator.
+ */
+class romu_duo_jr final : public detail::romu_base<romu_duo_jr, 2>
+{
+private:
+
+    using Base = detail::romu_base<romu_duo_jr, 2>;
+    friend Base;
+
+    static inline std::uint64_t step(std::array<std::uint64_t, 2>& s) noexcept
+    {
+        const std::uint64_t xp = s[0];
+        s[0] = UINT64_C(15241094284759029579) * s[1];
+        s[1] = boost::core::rotl(s[1] - xp, 27);
+        return xp;
+    }
+
+public:
+
+    using Base::Base;
+};
+
+/**
+ * This is RomuTrio, the general purpose member of the Romu family.  It
+ * has 192 bits of state and is recommended by its author whenever a
+ * single generator draws a very large number of values.
+ */
+class romu_trio final : public detail::romu_base<romu_trio, 3>
+{
+private:
+
+    using Base = detail::romu_base<romu_trio, 3>;
+    friend Base;
+
+    static inline std::uint64_t step(std::array<std::uint64_t, 3>& s) noexcept
+    {
+        const std::uint64_t xp = s[0];
+        const std::uint64_t yp = s[1];
+        const std::uint64_t zp = s[2];
+        s[0] = UINT64_C(15241094284759029579) * zp;
+        s[1] = boost::core::rotl(yp - xp, 12);
+        s[2] = boost::core::rotl(zp - yp, 44);
+        return xp;
+    }
+
+public:
+
+    using Base::Base;
+};
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_ROMU_HPP
@@ -0,0 +1,332 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_SECURE_ENGINE_HPP
+#define BOOST_RANDOM_SECURE_ENGINE_HPP
+
+#include <boost/random/chacha.hpp>
+#include <boost/random/random_device.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+#if defined(BOOST_HAS_PTHREADS)
+#include <pthread.h>
+#endif
+
+namespace boost {
+namespace random {
+namespace detail {
+
+inline void count_fork() noexcept;
+
+// Incremented in the child process after every fork().
+inline std::atomic<unsigned>& fork_generation() noexcept
+{
+    static std::atomic<unsigned> generation(0);
+#if defined(BOOST_HAS_PTHREADS)
+    static const bool registered = pthread_atfork(nullptr, nullptr, &count_fork) == 0;
+    static_cast<void>(registered);
+#endif
+    return generation;
+}
+
+inline void count_fork() noexcept
+{
+    fork_generation().fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+/**
+ * The limits after which a @c basic_secure_engine mixes new entropy
+ * into its key: a number of output bytes and a length of time,
+ * whichever is reached first.  They are passed as one object so that
+ * an integer cannot be taken for a seed.
+ *
+ * @code
+ * boost::random::secure_engine gen(boost::random::reseed_limits(4096));
+ * @endcode
+ */
+struct reseed_limits
+{
+    /** The default number of output bytes between reseeds, 1 MiB. */
+    static constexpr std::uint64_t default_bytes = UINT64_C(1) << 20U;
+
+    std::uint64_t bytes;
+    std::chrono::steady_clock::duration interval;
+
+    /** Reseeds after 1 MiB of output or five minutes. */
+    constexpr reseed_limits() noexcept
+        : bytes(default_bytes), interval(std::chrono::minutes(5))
+    {}
+
+    /** Reseeds after @c reseed_bytes bytes of output or after @c reseed_interval. */
+    explicit constexpr reseed_limits(std::uint64_t reseed_bytes,
+                                     std::chrono::steady_clock::duration reseed_interval = std::chrono::minutes(5)) noexcept
+        : bytes(reseed_bytes), interval(reseed_interval)
+    {}
+};
+
+/**
+ * Class template @c basic_secure_engine is a fast source of
+ * cryptographically strong random numbers for nonces, session
+ * identifiers and similar tokens.  It models a
+ * \uniform_random_number_generator, so the distributions can be used
+ * with it.
+ *
+ * The values are the ChaCha20 keystream, generated with fast key
+ * erasure:
+ *
+ *  @blockquote
+ *  "Fast-key-erasure random-number generators", Daniel J. Bernstein, 2017.
+ *  @endblockquote
+ *
+ * Each refill computes sixteen blocks with the current key.  The first
+ * eight words become the next key and the rest are handed out, each
+ * cleared from memory as it is returned.  So the state never holds
+ * anything from which earlier outputs can be recomputed.
+ *
+ * The key is taken from @c EntropySource when the engine is created,
+ * and new entropy is mixed into it again after the @c reseed_limits,
+ * and in the child process after a fork().  Those are
+ * the only calls to the source, so a \random_device costs one request
+ * per megabyte by default.
+ *
+ * @c generate() on a contiguous range of @c std::uint32_t writes the
+ * keystream straight into it, without going through the buffer.
+ *
+ * Objects cannot be copied, since a copy would repeat the output of the
+ * original.
+ */
+template <typename EntropySource = random_device>
+class basic_secure_engine final
+{
+private:
+
+    using cipher_type = chacha20;
+    using key_type = cipher_type::key_type;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::size_t block_words = 16;
+    static constexpr std::size_t key_words = 8;
+    static constexpr std::size_t buffer_words = 16 * block_words;
+    // largest run of blocks written by generate() without checking the reseed limits
+    static constexpr std::size_t bulk_words = 4096 * block_words;
+
+public:
+
+    using result_type = std::uint32_t;
+    using entropy_source_type = EntropySource;
+
+    static constexpr bool has_fixed_range {false};
+
+private:
+
+    EntropySource source_;
+    cipher_type cipher_;
+    std::array<std::uint32_t, buffer_words> buffer_;
+    std::size_t index_;
+    std::uint64_t bytes_;
+    std::uint64_t reseed_bytes_;
+    clock_type::duration reseed_interval_;
+    clock_type::time_point reseeded_;
+    const std::atomic<unsigned>* forks_;
+    unsigned fork_generation_;
+
+    bool reseed_due() const noexcept
+    {
+        return bytes_ >= reseed_bytes_ ||
+               forks_->load(std::memory_order_relaxed) != fork_generation_ ||
+               clock_type::now() - reseeded_ >= reseed_interval_;
+    }
+
+    // Replaces the key by the next eight keystream words mixed with
+    // eight words from the source.
+    void reseed()
+    {
+        fork_generation_ = forks_->load(std::memory_order_relaxed);
+        std::uint32_t block[block_words];
+        cipher_.generate(block, block + block_words);
+        key_type key;
+        source_.generate(key.begin(), key.end());
+        for (std::size_t i = 0; i < key_words; ++i)
+        {
+            key[i] ^= block[i];
+        }
+        cipher_.set_key(key);
+        detail::secure_wipe(block, block_words);
+        detail::secure_wipe(key.data(), key_words);
+        bytes_ = 0;
+        reseeded_ = clock_type::now();
+    }
+
+    // Moves the next key out of a block of keystream.
+    void rekey(std::uint32_t* words)
+    {
+        key_type key;
+        std::copy(words, words + key_words, key.begin());
+        cipher_.set_key(key);
+        detail::secure_wipe(words, key_words);
+        detail::secure_wipe(key.data(), key_words);
+    }
+
+    void refill()
+    {
+        if (reseed_due())
+        {
+            reseed();
+        }
+        cipher_.generate(buffer_.data(), buffer_.data() + buffer_words);
+        rekey(buffer_.data());
+        index_ = key_words;
+        bytes_ += (buffer_words - key_words) * sizeof(result_type);
+    }
+
+    // Drops the buffered values if the process has forked since they
+    // were computed.
+    void check_fork() noexcept
+    {
+        if (forks_->load(std::memory_order_relaxed) != fork_generation_ && index_ != buffer_words)
+        {
+            detail::secure_wipe(buffer_.data() + index_, buffer_words - index_);
+            index_ = buffer_words;
+        }
+    }
+
+public:
+
+    /**
+     * Constructs a @c basic_secure_engine that reseeds after 1 MiB of
+     * output or after five minutes, whichever comes first.
+     */
+    basic_secure_engine() : basic_secure_engine(reseed_limits()) {}
+
+    /**
+     * Constructs a @c basic_secure_engine that reseeds after
+     * @c limits.bytes bytes of output or after @c limits.interval,
+     * whichever comes first.
+     */
+    explicit basic_secure_engine(const reseed_limits& limits)
+        : index_(buffer_words), bytes_(0), reseed_bytes_(limits.bytes),
+          reseed_interval_(limits.interval), forks_(&detail::fork_generation())
+    {
+        key_type key;
+        source_.generate(key.begin(), key.end());
+        cipher_.set_key(key);
+        detail::secure_wipe(key.data(), key_words);
+        fork_generation_ = forks_->load(std::memory_order_relaxed);
+        reseeded_ = clock_type::now();
+    }
+
+    basic_secure_engine(const basic_secure_engine&) = delete;
+    basic_secure_engine& operator=(const basic_secure_engine&) = delete;
+
+    ~basic_secure_engine()
+    {
+        detail::secure_wipe(buffer_.data(), buffer_words);
+        cipher_.wipe();
+    }
+
+    /** Mixes new entropy from the source into the key now. */
+    void reseed_now()
+    {
+        detail::secure_wipe(buffer_.data() + index_, buffer_words - index_);
+        index_ = buffer_words;
+        reseed();
+    }
+
+    /** Returns the next value of the generator. */
+    result_type operator()()
+    {
+        check_fork();
+        if (index_ == buffer_words)
+        {
+            refill();
+        }
+        const result_type result = buffer_[index_];
+        buffer_[index_++] = 0;
+        return result;
+    }
+
+    /** Fills a range with random values. */
+    template <typename FIter>
+    void generate(FIter first, FIter last)
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        for (; first != last; ++first)
+        {
+            *first = static_cast<iter_type>((*this)());
+        }
+    }
+
+    /**
+     * Fills a contiguous range with random values.  Whole blocks are
+     * written in place, with one extra block per run for the next key.
+     */
+    void generate(std::uint32_t* first, std::uint32_t* last)
+    {
+        check_fork();
+        while (first != last && index_ != buffer_words)
+        {
+            *first++ = (*this)();
+        }
+
+        while (static_cast<std::size_t>(last - first) >= buffer_words)
+        {
+            if (reseed_due())
+            {
+                reseed();
+            }
+            const std::size_t n = (std::min)(static_cast<std::size_t>(last - first), static_cast<std::size_t>(bulk_words)) /
+                                  block_words * block_words;
+            std::uint32_t next[block_words];
+            cipher_.generate(next, next + block_words);
+            cipher_.generate(first, first + n);
+            rekey(next);
+            detail::secure_wipe(next + key_words, block_words - key_words);
+            first += n;
+            bytes_ += n * sizeof(result_type);
+        }
+
+        while (first != last)
+        {
+            *first++ = (*this)();
+        }
+    }
+
+    /** Returns the smallest value that the generator can produce. */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<result_type>::min)();
+    }
+
+    /** Returns the largest value that the generator can produce. */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+};
+
+/** A @c basic_secure_engine that takes its entropy from a \random_device. */
+using secure_engine = basic_secure_engine<random_device>;
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_SECURE_ENGINE_HPP
@@ -28,6 +28,83 @@
 namespace boost {
 namespace random {
 
+namespace detail {
+
+// The number of steps before one of the indices reaches n.
+inline std::size_t seed_seq_run(std::size_t n, std::size_t i, std::size_t j, std::size_t w)
+{
+    return n - (std::max)((std::max)(i, j), w);
+}
+
+inline void seed_seq_wrap(std::size_t n, std::size_t& i, std::size_t& j, std::size_t& w)
+{
+    if(i == n) i = 0;
+    if(j == n) j = 0;
+    if(w == n) w = 0;
+}
+
+// The algorithm of seed_seq::generate for the s values at v.
+template<class Iter>
+void seed_seq_generate(const boost::uint_least32_t* v, std::size_t s, Iter first, Iter last)
+{
+    typedef typename std::iterator_traits<Iter>::value_type value_type;
+    std::fill(first, last, static_cast<value_type>(0x8b8b8b8bu));
+    std::size_t n = last - first;
+    if(n == 0) return;
+    std::size_t t =
+        (n >= 623) ? 11 :
+        (n >=  68) ?  7 :
+        (n >=  39) ?  5 :
+        (n >=   7) ?  3 :
+        (n - 1)/2;
+    std::size_t p = (n - t) / 2;
+    std::size_t q = p + t;
+    std::size_t m = (std::max)(s+1, n);
+    value_type mask = 0xffffffffu;
+    // i, j and w stand for k%n, (k+p)%n and (k+q)%n.  They all
+    // advance by one per step, so each loop runs in segments that
+    // end when one of them reaches n and is wrapped.  The element
+    // at (k+n-1)%n is always the one stored last, so it is kept in
+    // prev instead of being read back.
+    std::size_t i = 0, j = p, w = q;
+    value_type prev = *(first + (n - 1));
+    for(std::size_t k = 0; k < m; seed_seq_wrap(n, i, j, w)) {
+        std::size_t end = k + (std::min)(m - k, seed_seq_run(n, i, j, w));
+        for(; k < end; ++k, ++i, ++j, ++w) {
+            value_type r1 = static_cast<value_type>
+                (*(first + i) ^ *(first + j) ^ prev);
+            r1 = r1 ^ (r1 >> 27);
+            r1 = (r1 * 1664525u) & mask;
+            value_type r2 = static_cast<value_type>(r1 +
+                ((k == 0) ? s :
+                 (k <= s) ? i + v[k - 1] :
+                 i));
+            *(first + j) = (*(first + j) + r1) & mask;
+            *(first + w) = (*(first + w) + r2) & mask;
+            *(first + i) = r2;
+            prev = r2;
+        }
+    }
+    i = m % n; j = (m + p) % n; w = (m + q) % n;
+    for(std::size_t k = m; k < m + n; seed_seq_wrap(n, i, j, w)) {
+        std::size_t end = k + (std::min)(m + n - k, seed_seq_run(n, i, j, w));
+        for(; k < end; ++k, ++i, ++j, ++w) {
+            value_type r3 = static_cast<value_type>
+                ((*(first + i) + *(first + j) + prev)
+                & mask);
+            r3 = r3 ^ (r3 >> 27);
+            r3 = (r3 * 1566083941u) & mask;
+            value_type r4 = static_cast<value_type>(r3 - i);
+            *(first + j) ^= r3;
+            *(first + w) ^= r4;
+            *(first + i) = r4;
+            prev = r4;
+        }
+    }
+}
+
+} // namespace detail
+
 /**
  * The class @c seed_seq stores a sequence of 32-bit words
  * for seeding a \pseudo_random_number_generator.  These
@@ -62,44 +139,7 @@ public:
     template<class Iter>
     void generate(Iter first, Iter last) const
     {
-        typedef typename std::iterator_traits<Iter>::value_type value_type;
-        std::fill(first, last, static_cast<value_type>(0x8b8b8b8bu));
-        std::size_t s = v.size();
-        std::size_t n = last - first;
-        std::size_t t =
-            (n >= 623) ? 11 :
-            (n >=  68) ?  7 :
-            (n >=  39) ?  5 :
-            (n >=   7) ?  3 :
-            (n - 1)/2;
-        std::size_t p = (n - t) / 2;
-        std::size_t q = p + t;
-        std::size_t m = (std::max)(s+1, n);
-        value_type mask = 0xffffffffu;
-        for(std::size_t k = 0; k < m; ++k) {
-            value_type r1 = static_cast<value_type>
-                (*(first + k%n) ^ *(first + (k+p)%n) ^ *(first + (k+n-1)%n));
-            r1 = r1 ^ (r1 >> 27);
-            r1 = (r1 * 1664525u) & mask;
-            value_type r2 = static_cast<value_type>(r1 +
-                ((k == 0) ? s :
-                 (k <= s) ? k % n + v[k - 1] :
-                 (k % n)));
-            *(first + (k+p)%n) = (*(first + (k+p)%n) + r1) & mask;
-            *(first + (k+q)%n) = (*(first + (k+q)%n) + r2) & mask;
-            *(first + k%n) = r2;
-        }
-        for(std::size_t k = m; k < m + n; ++k) {
-            value_type r3 = static_cast<value_type>
-                ((*(first + k%n) + *(first + (k+p)%n) + *(first + (k+n-1)%n))
-                & mask);
-            r3 = r3 ^ (r3 >> 27);
-            r3 = (r3 * 1566083941u) & mask;
-            value_type r4 = static_cast<value_type>(r3 - k%n);
-            *(first + (k+p)%n) ^= r3;
-            *(first + (k+q)%n) ^= r4;
-            *(first + k%n) = r4;
-        }
+        detail::seed_seq_generate(v.empty() ? 0 : &v[0], v.size(), first, last);
     }
     /** Returns the size of the sequence. */
     std::size_t size() const { return v.size(); }
@@ -0,0 +1,257 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_SFC64_HPP
+#define BOOST_RANDOM_SFC64_HPP
+
+#include <boost/throw_exception.hpp>
+#include <boost/core/bit.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <ios>
+#include <istream>
+#include <type_traits>
+#include <iterator>
+
+namespace boost { namespace random {
+
+/**
+ * This is Chris Doty-Humphrey's Small Fast Chaotic generator sfc64 from
+ * PractRand.  It has 256 bits of state, three chaotic words and a 64-bit
+ * counter which guarantees a minimum period of 2^64 for every seed, and it
+ * passes all tests we are aware of.  The transition function is not
+ * linear, so @c discard() is a loop.
+ *
+ * Seeding from an integer matches PractRand and seeding from a @c SeedSeq
+ * matches numpy's SFC64: six 32-bit values are paired, low half first,
+ * into the three chaotic words, the counter is set to 1 and 12 values
+ * are dropped.  So a @c SeedSeq that produces the same values as numpy's
+ * @c SeedSequence gives the same stream.
+ */
+class sfc64
+{
+private:
+    std::array<std::uint64_t, 4> state_;
+
+    static inline std::uint64_t concatenate(std::uint32_t word1, std::uint32_t word2) noexcept
+    {
+        return static_cast<std::uint64_t>(word1) << 32 | word2;
+    }
+
+    static inline std::uint64_t step(std::array<std::uint64_t, 4>& s) noexcept
+    {
+        const std::uint64_t tmp = s[0] + s[1] + s[3]++;
+        s[0] = s[1] ^ (s[1] >> 11);
+        s[1] = s[2] + (s[2] << 3);
+        s[2] = boost::core::rotl(s[2], 24) + tmp;
+        return tmp;
+    }
+
+    void seed_words(std::uint64_t a, std::uint64_t b, std::uint64_t c) noexcept
+    {
+        state_ = {{ a, b, c, 1 }};
+        for (int i = 0; i < 12; ++i)
+        {
+            step(state_);
+        }
+    }
+
+public:
+    using result_type = std::uint64_t;
+    using seed_type = std::uint64_t;
+
+    // Required for old Boost.Random concept
+    static constexpr bool has_fixed_range {false};
+
+    /** Seeds the generator with a user provided seed. */
+    void seed(const seed_type value = 0) noexcept
+    {
+        seed_words(value, value, value);
+    }
+
+    /**
+     * Seeds the generator with 32-bit values produced by @c seq.generate().
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    void seed(Sseq& seq)
+    {
+        std::array<std::uint32_t, 6> seeds;
+        seq.generate(seeds.begin(), seeds.end());
+
+        // numpy takes the first word of each pair as the low half.
+        seed_words(concatenate(seeds[1], seeds[0]),
+                   concatenate(seeds[3], seeds[2]),
+                   concatenate(seeds[5], seeds[4]));
+    }
+
+    /**
+     * Sets the state of the generator using values from an iterator range.
+     * The values are used as is, with the counter last.
+     */
+    template <typename FIter>
+    void seed(FIter first, FIter last)
+    {
+        static_assert(std::is_integral<typename std::iterator_traits<FIter>::value_type>::value,
+                      "Value type must be a built-in integer type" );
+
+        std::size_t offset = 0;
+        while (first != last && offset < state_.size())
+        {
+            state_[offset++] = static_cast<std::uint64_t>(*first++);
+        }
+
+        if (offset != state_.size())
+        {
+            boost::throw_exception(std::invalid_argument("Not enough elements in call to seed."));
+        }
+    }
+
+    /** Seeds the generator with a user provided seed. */
+    explicit sfc64(const seed_type value = 0) noexcept
+    {
+        seed(value);
+    }
+
+    /**
+     * Seeds the generator with 32-bit values produced by @c seq.generate().
+     *
+     * @xmlnote
+     * The copy constructor will always be preferred over
+     * the templated constructor.
+     * @endxmlnote
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, sfc64>::value &&
+                                                     !std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    explicit sfc64(Sseq& seq)
+    {
+        seed(seq);
+    }
+
+    template <typename FIter>
+    sfc64(FIter& first, FIter last) { seed(first, last); }
+
+    sfc64(const sfc64& other) = default;
+    sfc64& operator=(const sfc64& other) = default;
+
+    /**  Returns the next value of the generator. */
+    inline result_type next() noexcept
+    {
+        return step(state_);
+    }
+
+    /**  Returns the next value of the generator. */
+    inline result_type operator()() noexcept
+    {
+        return next();
+    }
+
+    /** Advances the state of the generator by @c z. */
+    inline void discard(std::uint64_t z) noexcept
+    {
+        std::array<std::uint64_t, 4> s = state_;
+        for (std::uint64_t i {}; i < z; ++i)
+        {
+            step(s);
+        }
+        state_ = s;
+    }
+
+    /**
+     * Fills a range with random values.  The state is kept in locals for
+     * the whole range so that stores to the output do not force it back
+     * to memory on every step.
+     */
+    template <typename FIter>
+    inline void generate(FIter first, FIter last) noexcept
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        std::array<std::uint64_t, 4> s = state_;
+        while (first != last)
+        {
+            *first++ = static_cast<iter_type>(step(s));
+        }
+        state_ = s;
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    inline friend bool operator==(const sfc64& lhs, const sfc64& rhs) noexcept
+    {
+        return lhs.state_ == rhs.state_;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    inline friend bool operator!=(const sfc64& lhs, const sfc64& rhs) noexcept
+    {
+        return lhs.state_ != rhs.state_;
+    }
+
+    /**  Writes a @c sfc64 to a @c std::ostream. */
+    template <typename CharT, typename Traits>
+    inline friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& ost,
+                                                                const sfc64& e)
+    {
+        for (std::size_t i {}; i < e.state_.size(); ++i)
+        {
+            ost << e.state_[i] << ' ';
+        }
+
+        return ost;
+    }
+
+    /**  Reads a @c sfc64 from a @c std::istream. */
+    template <typename CharT, typename Traits>
+    inline friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& ist,
+                                                                sfc64& e)
+    {
+        for (std::size_t i {}; i < e.state_.size(); ++i)
+        {
+            ist >> e.state_[i] >> std::ws;
+        }
+
+        return ist;
+    }
+
+    /**
+     * Returns the largest value that the @c sfc64
+     * can produce.
+     */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<std::uint64_t>::max)();
+    }
+
+    /**
+     * Returns the smallest value that the @c sfc64
+     * can produce.
+     */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<std::uint64_t>::min)();
+    }
+
+    inline std::array<std::uint64_t, 4> state() const noexcept
+    {
+        return state_;
+    }
+};
+
+}} // Namespace boost::random
+
+#endif // BOOST_RANDOM_SFC64_HPP
@@ -0,0 +1,96 @@
+/* boost random/shared_random_device.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_SHARED_RANDOM_DEVICE_HPP
+#define BOOST_RANDOM_SHARED_RANDOM_DEVICE_HPP
+
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/random/detail/auto_link.hpp>
+#include <boost/system/config.hpp> // force autolink to find Boost.System
+
+namespace boost {
+namespace random {
+
+/**
+ * Class @c shared_random_device is a \nondeterministic_random_number_generator
+ * with the same interface as \random_device.  All of its objects draw
+ * from one process-wide buffer of values read from the default
+ * \random_device, so they are cheap to create and copy, and most calls
+ * do not make a request to the operating system.
+ *
+ * Threads take their values from the buffer by advancing a shared
+ * cursor with an atomic compare-and-swap, without locks.  When the
+ * buffer runs out, the thread that notices refills it with one request
+ * to the device, while any other thread that needs values in the
+ * meantime reads them from the device directly.  Ranges of more than
+ * 256 values passed to @c generate are always read directly.
+ *
+ * Every value is handed out at most once.  On POSIX systems the buffer
+ * is discarded in the child process after a fork(), so that parent and
+ * child do not produce the same values.
+ *
+ * @code
+ * boost::random::shared_random_device rd;
+ * boost::random::mt19937 gen(rd);
+ * @endcode
+ */
+class shared_random_device
+{
+public:
+    typedef unsigned int result_type;
+    BOOST_STATIC_CONSTANT(bool, has_fixed_range = false);
+
+    /** Returns the smallest value that the @c shared_random_device can produce. */
+    static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION () { return 0; }
+    /** Returns the largest value that the @c shared_random_device can produce. */
+    static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION () { return ~0u; }
+
+    /** Returns the entropy estimate of the default \random_device. */
+    BOOST_RANDOM_DECL double entropy() const;
+    /** Returns a random value in the range [min, max]. */
+    BOOST_RANDOM_DECL unsigned int operator()();
+
+    /** Fills a range with random 32-bit values. */
+    template<class Iter>
+    void generate(Iter begin, Iter end)
+    {
+        unsigned int buffer[256];
+        while(begin != end) {
+            std::size_t n = 0;
+            for(Iter iter = begin; n < 256 && iter != end; ++iter) {
+                ++n;
+            }
+            fill(buffer, n);
+            for(std::size_t i = 0; i < n; ++i, ++begin) {
+                *begin = buffer[i];
+            }
+        }
+    }
+
+    /** Fills a contiguous range with random 32-bit values. */
+    void generate(unsigned int* begin, unsigned int* end)
+    {
+        fill(begin, static_cast<std::size_t>(end - begin));
+    }
+
+private:
+    BOOST_RANDOM_DECL static void fill(unsigned int* first, std::size_t n);
+};
+
+} // namespace random
+
+using random::shared_random_device;
+
+} // namespace boost
+
+#endif // BOOST_RANDOM_SHARED_RANDOM_DEVICE_HPP
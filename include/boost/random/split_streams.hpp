@@ -0,0 +1,452 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_SPLIT_STREAMS_HPP
+#define BOOST_RANDOM_SPLIT_STREAMS_HPP
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifndef BOOST_RANDOM_CACHE_LINE_SIZE
+#define BOOST_RANDOM_CACHE_LINE_SIZE 64
+#endif
+
+namespace boost {
+namespace random {
+
+template<class IntType, IntType a, IntType c, IntType m>
+class linear_congruential_engine;
+class rand48;
+template<class IntType, IntType a, IntType b, IntType p>
+class inversive_congruential_engine;
+template<class UIntType, int w, int k, int q, int s>
+class linear_feedback_shift_engine;
+template<class MLCG1, class MLCG2>
+class additive_combine_engine;
+template<class URNG1, int s1, class URNG2, int s2>
+class xor_combine_engine;
+template<class UniformRandomNumberGenerator, std::size_t p, std::size_t r>
+class discard_block_engine;
+template<class IntType, std::size_t w, std::size_t s, std::size_t r>
+class subtract_with_carry_engine;
+template<class RealType, std::size_t w, std::size_t s, std::size_t r>
+class subtract_with_carry_01_engine;
+template<class UIntType, int w, unsigned int p, unsigned int q>
+class lagged_fibonacci_engine;
+template<class RealType, int w, unsigned int p, unsigned int q>
+class lagged_fibonacci_01_engine;
+template<int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL>
+class mixmax_engine;
+template<class Output, class Stream>
+class pcg_engine;
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+class philox_engine;
+template<std::size_t Rounds>
+class threefry4x64_engine;
+template<std::size_t Rounds>
+class chacha_engine;
+template<typename Engine, std::size_t Lanes>
+class xoshiro_lanes;
+class splitmix64;
+class wyrand;
+
+namespace detail {
+
+// The period of an engine, or 0 if it is at least 2^64.  Streams that
+// are split with discard() divide the period evenly, so engines with a
+// short period must say so here.
+template<class Engine>
+struct stream_period
+{
+    static std::uintmax_t value() { return 0; }
+};
+
+inline std::uintmax_t period_lcm(std::uintmax_t p1, std::uintmax_t p2)
+{
+    if(p1 == 0 || p2 == 0) return 0;
+    std::uintmax_t a = p1, b = p2;
+    while(b != 0) { const std::uintmax_t t = a % b; a = b; b = t; }
+    const std::uintmax_t q = p1 / a;
+    if(q > (std::numeric_limits<std::uintmax_t>::max)() / p2) return 0;
+    return q * p2;
+}
+
+template<class IntType, IntType a, IntType c, IntType m>
+struct stream_period<linear_congruential_engine<IntType, a, c, m> >
+{
+    static std::uintmax_t value()
+    {
+        typedef typename std::make_unsigned<IntType>::type unsigned_type;
+        if(m == 0) {
+            // modulus 2^digits
+            const int digits = std::numeric_limits<unsigned_type>::digits;
+            return digits >= std::numeric_limits<std::uintmax_t>::digits ?
+                0 : std::uintmax_t(1) << (digits % std::numeric_limits<std::uintmax_t>::digits);
+        }
+        return c == 0 ? std::uintmax_t(m) - 1 : std::uintmax_t(m);
+    }
+};
+
+template<>
+struct stream_period<rand48>
+{
+    static std::uintmax_t value() { return std::uintmax_t(1) << 48; }
+};
+
+template<class IntType, IntType a, IntType b, IntType p>
+struct stream_period<inversive_congruential_engine<IntType, a, b, p> >
+{
+    static std::uintmax_t value() { return std::uintmax_t(p); }
+};
+
+template<class UIntType, int w, int k, int q, int s>
+struct stream_period<linear_feedback_shift_engine<UIntType, w, k, q, s> >
+{
+    static std::uintmax_t value()
+    {
+        return k >= std::numeric_limits<std::uintmax_t>::digits ?
+            0 : (std::uintmax_t(1) << (k % std::numeric_limits<std::uintmax_t>::digits)) - 1;
+    }
+};
+
+template<class MLCG1, class MLCG2>
+struct stream_period<additive_combine_engine<MLCG1, MLCG2> >
+{
+    static std::uintmax_t value()
+    { return period_lcm(stream_period<MLCG1>::value(), stream_period<MLCG2>::value()); }
+};
+
+template<class URNG1, int s1, class URNG2, int s2>
+struct stream_period<xor_combine_engine<URNG1, s1, URNG2, s2> >
+{
+    static std::uintmax_t value()
+    { return period_lcm(stream_period<URNG1>::value(), stream_period<URNG2>::value()); }
+};
+
+template<class URNG, std::size_t p, std::size_t r>
+struct stream_period<discard_block_engine<URNG, p, r> >
+{
+    static std::uintmax_t value()
+    {
+        // a block of p base values gives r outputs
+        const std::uintmax_t base = stream_period<URNG>::value();
+        return base == 0 ? 0 : base / p * r;
+    }
+};
+
+template<class Engine, class = void>
+struct has_jump : std::false_type {};
+
+template<class Engine>
+struct has_jump<Engine, decltype(void(std::declval<Engine&>().jump()))> : std::true_type {};
+
+template<class Engine, class = void>
+struct has_jump_plan : std::false_type {};
+
+template<class Engine>
+struct has_jump_plan<Engine, decltype(void(sizeof(typename Engine::jump_plan)))> : std::true_type {};
+
+// Whether discard(z) takes time sublinear in z, so that an engine can
+// be advanced by a share of its period.  Engines that step z times,
+// such as sfc64, the romu family, shuffle_order_engine and
+// independent_bits_engine, must not be split with discard().
+template<class Engine>
+struct has_fast_discard : std::false_type {};
+
+template<class IntType, IntType a, IntType c, IntType m>
+struct has_fast_discard<linear_congruential_engine<IntType, a, c, m> > : std::true_type {};
+
+template<>
+struct has_fast_discard<rand48> : std::true_type {};
+
+// the jump needs an odd prime modulus below 2^32
+template<class IntType, IntType a, IntType b, IntType p>
+struct has_fast_discard<inversive_congruential_engine<IntType, a, b, p> >
+  : std::integral_constant<bool, (a != 0 && p > 2 && p % 2 == 1 &&
+                                  static_cast<std::uintmax_t>(p) <= 0xffffffffu)> {};
+
+template<class UIntType, int w, int k, int q, int s>
+struct has_fast_discard<linear_feedback_shift_engine<UIntType, w, k, q, s> > : std::true_type {};
+
+template<class MLCG1, class MLCG2>
+struct has_fast_discard<additive_combine_engine<MLCG1, MLCG2> >
+  : std::integral_constant<bool, has_fast_discard<MLCG1>::value && has_fast_discard<MLCG2>::value> {};
+
+template<class URNG1, int s1, class URNG2, int s2>
+struct has_fast_discard<xor_combine_engine<URNG1, s1, URNG2, s2> >
+  : std::integral_constant<bool, has_fast_discard<URNG1>::value && has_fast_discard<URNG2>::value> {};
+
+template<class URNG, std::size_t p, std::size_t r>
+struct has_fast_discard<discard_block_engine<URNG, p, r> > : has_fast_discard<URNG> {};
+
+template<class IntType, std::size_t w, std::size_t s, std::size_t r>
+struct has_fast_discard<subtract_with_carry_engine<IntType, w, s, r> >
+  : std::integral_constant<bool, (w <= 64)> {};
+
+template<class RealType, std::size_t w, std::size_t s, std::size_t r>
+struct has_fast_discard<subtract_with_carry_01_engine<RealType, w, s, r> >
+  : std::integral_constant<bool, (w <= 64)> {};
+
+template<class UIntType, int w, unsigned int p, unsigned int q>
+struct has_fast_discard<lagged_fibonacci_engine<UIntType, w, p, q> >
+  : std::integral_constant<bool, (w <= 64)> {};
+
+template<class RealType, int w, unsigned int p, unsigned int q>
+struct has_fast_discard<lagged_fibonacci_01_engine<RealType, w, p, q> >
+  : std::integral_constant<bool, (w <= 64)> {};
+
+template<int Ndim, unsigned int SPECIALMUL, std::int64_t SPECIAL>
+struct has_fast_discard<mixmax_engine<Ndim, SPECIALMUL, SPECIAL> > : std::true_type {};
+
+template<class Output, class Stream>
+struct has_fast_discard<pcg_engine<Output, Stream> > : std::true_type {};
+
+template<class UIntType, std::size_t w, std::size_t n, std::size_t r, UIntType... consts>
+struct has_fast_discard<philox_engine<UIntType, w, n, r, consts...> > : std::true_type {};
+
+template<std::size_t Rounds>
+struct has_fast_discard<threefry4x64_engine<Rounds> > : std::true_type {};
+
+template<std::size_t Rounds>
+struct has_fast_discard<chacha_engine<Rounds> > : std::true_type {};
+
+template<typename Engine, std::size_t Lanes>
+struct has_fast_discard<xoshiro_lanes<Engine, Lanes> > : std::true_type {};
+
+template<>
+struct has_fast_discard<splitmix64> : std::true_type {};
+
+template<>
+struct has_fast_discard<wyrand> : std::true_type {};
+
+// Whether split_streams can give an engine non-overlapping streams
+// without generating the values in between.
+template<class Engine>
+struct is_splittable
+  : std::integral_constant<bool, has_jump<Engine>::value ||
+                                 has_jump_plan<Engine>::value ||
+                                 has_fast_discard<Engine>::value> {};
+
+} // namespace detail
+
+/**
+ * A fixed number of engines, each in its own cache line, as returned
+ * by @c split_streams.  Workers that each use one of the engines do not
+ * share cache lines, so they do not slow each other down by false
+ * sharing.
+ */
+template<class Engine>
+class engine_streams
+{
+public:
+    typedef Engine engine_type;
+
+    engine_streams() noexcept : _storage(nullptr), _slots(nullptr), _size(0) {}
+
+    engine_streams(engine_streams&& other) noexcept
+      : _storage(other._storage), _slots(other._slots), _size(other._size)
+    {
+        other._storage = nullptr;
+        other._slots = nullptr;
+        other._size = 0;
+    }
+
+    engine_streams& operator=(engine_streams&& other) noexcept
+    {
+        if(this != &other) {
+            clear();
+            std::swap(_storage, other._storage);
+            std::swap(_slots, other._slots);
+            std::swap(_size, other._size);
+        }
+        return *this;
+    }
+
+    engine_streams(const engine_streams&) = delete;
+    engine_streams& operator=(const engine_streams&) = delete;
+
+    ~engine_streams() { clear(); }
+
+    /** Returns the number of engines. */
+    std::size_t size() const noexcept { return _size; }
+
+    /** Returns the i-th engine. */
+    Engine& operator[](std::size_t i) noexcept { return _slots[i].engine; }
+    /** Returns the i-th engine. */
+    const Engine& operator[](std::size_t i) const noexcept { return _slots[i].engine; }
+
+private:
+    /// \cond show_private
+    struct alignas(BOOST_RANDOM_CACHE_LINE_SIZE) slot
+    {
+        explicit slot(const Engine& e) : engine(e) {}
+        Engine engine;
+    };
+
+    template<class E>
+    friend engine_streams<E> split_streams(const E& master, std::size_t n);
+
+    engine_streams(const Engine& master, std::size_t n)
+      : _storage(nullptr), _slots(nullptr), _size(0)
+    {
+        if(n == 0) return;
+        const std::size_t align = alignof(slot);
+        _storage = ::operator new(n * sizeof(slot) + align - 1);
+        const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(_storage);
+        _slots = reinterpret_cast<slot*>((addr + align - 1) / align * align);
+        try {
+            for(; _size < n; ++_size) {
+                ::new (static_cast<void*>(_slots + _size)) slot(master);
+            }
+        } catch(...) {
+            clear();
+            throw;
+        }
+    }
+
+    void clear() noexcept
+    {
+        while(_size != 0) {
+            _slots[--_size].~slot();
+        }
+        ::operator delete(_storage);
+        _storage = nullptr;
+        _slots = nullptr;
+    }
+    /// \endcond
+
+    void* _storage;
+    slot* _slots;
+    std::size_t _size;
+};
+
+namespace detail {
+
+// Advances an engine by k stream lengths, for a split into n streams.
+template<class Engine,
+         bool Jump = has_jump<Engine>::value,
+         bool Plan = has_jump_plan<Engine>::value>
+class stream_splitter;
+
+// jump() is the advance made for parallel streams (xoshiro)
+template<class Engine, bool Plan>
+class stream_splitter<Engine, true, Plan>
+{
+public:
+    explicit stream_splitter(std::size_t) {}
+    void advance(Engine& e, std::size_t k) const
+    {
+        for(; k != 0; --k) {
+            e.jump();
+        }
+    }
+};
+
+// one precomputed jump of 2^64 - 1, applied repeatedly (mersenne_twister)
+template<class Engine>
+class stream_splitter<Engine, false, true>
+{
+public:
+    explicit stream_splitter(std::size_t)
+      : _plan((std::numeric_limits<std::uintmax_t>::max)())
+    {}
+    void advance(Engine& e, std::size_t k) const
+    {
+        for(; k != 0; --k) {
+            _plan.apply(e);
+        }
+    }
+private:
+    typename Engine::jump_plan _plan;
+};
+
+// equal shares of the period, using discard()
+template<class Engine>
+class stream_splitter<Engine, false, false>
+{
+public:
+    explicit stream_splitter(std::size_t n)
+    {
+        BOOST_ASSERT(n != 0);
+        const std::uintmax_t period = stream_period<Engine>::value();
+        _stride = (period == 0 ? (std::numeric_limits<std::uintmax_t>::max)() : period) / n;
+        if(_stride == 0) {
+            boost::throw_exception(std::invalid_argument(
+                "split_streams: more streams than the period of the generator"));
+        }
+    }
+    // k < n, so this does not overflow
+    void advance(Engine& e, std::size_t k) const { e.discard(_stride * k); }
+private:
+    std::uintmax_t _stride;
+};
+
+} // namespace detail
+
+/**
+ * Returns @c n engines whose output sequences do not overlap.  Engine 0
+ * is a copy of @c master, and engine k starts where engine k-1 would be
+ * after a fixed number of values, chosen by the cheapest guarantee the
+ * engine offers:
+ *
+ * - Engines with @c jump(), such as the xoshiro family, are advanced by
+ *   one jump per stream, giving each stream 2^64 or more values.
+ * - Engines with a @c jump_plan, such as @c mt19937, apply one
+ *   precomputed jump of 2^64-1 values per stream.
+ * - Engines whose @c discard() takes time logarithmic in the distance
+ *   or better divide their period, or 2^64-1 if the period is longer,
+ *   evenly between the streams.  These are the linear congruential,
+ *   inversive congruential, linear feedback shift, subtract with
+ *   carry, lagged Fibonacci, mixmax, PCG and counter-based engines,
+ *   @c splitmix64, @c wyrand, @c xoshiro_lanes, and the combining and
+ *   discard_block adaptors over them.
+ *
+ * Other engines, such as @c sfc64, the romu engines, @c knuth_b and
+ * the other @c shuffle_order_engine and @c independent_bits_engine
+ * instances, could only be split by generating every value in between,
+ * so they are rejected at compile time.  Seed them from distinct seed
+ * sequences instead.
+ *
+ * Throws @c std::invalid_argument if @c n exceeds the period.
+ *
+ * @code
+ * boost::random::engine_streams<boost::random::xoshiro256pp> gens =
+ *     boost::random::split_streams(boost::random::xoshiro256pp(42), workers);
+ * // worker i uses gens[i]
+ * @endcode
+ */
+template<class Engine>
+engine_streams<Engine> split_streams(const Engine& master, std::size_t n)
+{
+    static_assert(detail::is_splittable<Engine>::value,
+                  "split_streams requires jump(), a jump_plan or a discard() that is faster than stepping");
+    engine_streams<Engine> result(master, n);
+    if(n > 1) {
+        const detail::stream_splitter<Engine> splitter(n);
+        for(std::size_t k = 1; k < n; ++k) {
+            result[k] = result[k - 1];
+            splitter.advance(result[k], 1);
+        }
+    }
+    return result;
+}
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_SPLIT_STREAMS_HPP
@@ -0,0 +1,110 @@
+/* boost random/static_seed_seq.hpp header file
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_STATIC_SEED_SEQ_HPP
+#define BOOST_RANDOM_STATIC_SEED_SEQ_HPP
+
+#include <boost/random/seed_seq.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+#include <array>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace boost {
+namespace random {
+
+namespace detail {
+
+template<class... T>
+struct all_integral : std::true_type {};
+
+template<class T, class... Rest>
+struct all_integral<T, Rest...>
+  : std::integral_constant<bool, std::is_integral<T>::value && all_integral<Rest...>::value> {};
+
+} // namespace detail
+
+/**
+ * The class template @c static_seed_seq stores up to @c N 32-bit words
+ * in place, and produces the same values as a @c seed_seq holding the
+ * same words.  It never allocates, so it can be built and used to seed
+ * an engine wherever a \pseudo_random_number_generator is created, for
+ * instance once per task.  It can also be a @c constexpr constant.
+ *
+ * @code
+ * boost::random::static_seed_seq<4> seq = { task_id, 42u };
+ * boost::random::mt19937 gen(seq);
+ * @endcode
+ */
+template<std::size_t N>
+class static_seed_seq {
+public:
+    typedef boost::uint_least32_t result_type;
+
+    /** Initializes a static_seed_seq to hold an empty sequence. */
+    constexpr static_seed_seq() : v(), s(0) {}
+    /** Initializes the sequence from up to @c N integers. */
+    template<class... T,
+             class = typename std::enable_if<detail::all_integral<T...>::value>::type>
+    constexpr static_seed_seq(T... values)
+      : v{{static_cast<result_type>(values)...}}, s(sizeof...(T))
+    {
+        static_assert(sizeof...(T) <= N, "Too many values for static_seed_seq");
+    }
+    /**
+     * Initializes the sequence from an iterator range.  Throws
+     * @c std::invalid_argument if it holds more than @c N values.
+     */
+    template<class Iter,
+             class = typename std::enable_if<!std::is_integral<Iter>::value>::type>
+    static_seed_seq(Iter first, Iter last) : v(), s(0)
+    {
+        for(; first != last; ++first) {
+            if(s == N) {
+                boost::throw_exception(std::invalid_argument("Too many elements in call to static_seed_seq."));
+            }
+            v[s++] = static_cast<result_type>(*first);
+        }
+    }
+
+    /**
+     * Fills a range with 32-bit values based on the stored sequence.
+     *
+     * Requires: Iter must be a Random Access Iterator whose value type
+     * is an unsigned integral type at least 32 bits wide.
+     */
+    template<class Iter>
+    void generate(Iter first, Iter last) const
+    {
+        detail::seed_seq_generate(v.data(), s, first, last);
+    }
+    /** Returns the size of the sequence. */
+    constexpr std::size_t size() const { return s; }
+    /** Returns the largest number of values the sequence can hold. */
+    static constexpr std::size_t capacity() { return N; }
+    /** Writes the stored sequence to iter. */
+    template<class Iter>
+    void param(Iter out) const { std::copy(v.begin(), v.begin() + s, out); }
+private:
+    std::array<result_type, N> v;
+    std::size_t s;
+};
+
+}
+}
+
+#endif
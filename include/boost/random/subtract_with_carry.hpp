@@ -20,6 +20,7 @@
 #include <iostream>
 #include <algorithm>     // std::equal
 #include <stdexcept>
+#include <vector>
 #include <boost/config.hpp>
 #include <boost/limits.hpp>
 #include <boost/cstdint.hpp>
@@ -32,6 +33,7 @@
 #include <boost/random/detail/operators.hpp>
 #include <boost/random/detail/seed_impl.hpp>
 #include <boost/random/detail/generator_seed_seq.hpp>
+#include <boost/random/detail/subtract_with_carry_lcg.hpp>
 #include <boost/random/linear_congruential.hpp>
 
 
@@ -44,6 +46,43 @@ struct subtract_with_carry_discard
 {
     template<class Engine>
     static void apply(Engine& eng, boost::uintmax_t z)
+    {
+#ifndef BOOST_RANDOM_SUBTRACT_WITH_CARRY_DISCARD_THRESHOLD
+#define BOOST_RANDOM_SUBTRACT_WITH_CARRY_DISCARD_THRESHOLD 10000
+#endif
+        // the jump needs z >= long_lag to recover the window exactly
+        if(Engine::word_size <= 64 && z >= Engine::long_lag &&
+           z > BOOST_RANDOM_SUBTRACT_WITH_CARRY_DISCARD_THRESHOLD) {
+            jump(eng, z);
+        } else {
+            step(eng, z);
+        }
+    }
+
+    /**
+     * Advances the engine through the equivalent linear congruential
+     * generator, in O(log z) multiplications modulo b^r - b^s + 1.
+     */
+    template<class Engine>
+    static void jump(Engine& eng, boost::uintmax_t z)
+    {
+        const std::size_t long_lag = Engine::long_lag;
+        const subtract_with_carry_lcg lcg(Engine::word_size,
+                                          Engine::short_lag, long_lag);
+        std::vector<boost::uint64_t> digits(long_lag);
+        unsigned c = eng.get_state(&digits[0]);
+        subtract_with_carry_lcg::number y = lcg.from_state(&digits[0], c);
+        const std::size_t k = static_cast<std::size_t>(
+            ((z % long_lag) + eng.k) % long_lag);
+        // y == 0 only for the two fixed points, which discard() leaves alone
+        if(!subtract_with_carry_lcg::is_zero(y)) {
+            c = lcg.to_state(lcg.advance(y, z), &digits[0]);
+        }
+        eng.set_state(&digits[0], c, k);
+    }
+
+    template<class Engine>
+    static void step(Engine& eng, boost::uintmax_t z)
     {
         typedef typename Engine::result_type IntType;
         const std::size_t short_lag = Engine::short_lag;
@@ -69,7 +108,9 @@ struct subtract_with_carry_discard
 
         k = ((z % long_lag) + k) % long_lag;
 
-        if(k < z) {
+        // Starting from k == 0 with z < long_lag leaves k == z, and
+        // that partial block still has to be updated.
+        if(k < z || eng.k == 0) {
             // main loop: update full blocks from k = 0 to long_lag
             for(std::size_t i = 0; i < (z - k) / long_lag; ++i) {
                 for(std::size_t j = 0; j < short_lag; ++j) {
@@ -268,20 +309,32 @@ private:
 
     friend struct detail::subtract_with_carry_discard;
 
+    // Copies the window, oldest first, and returns the carry.
+    unsigned get_state(boost::uint64_t* digits) const
+    {
+        for(unsigned int j = 0; j < long_lag; ++j)
+            digits[j] = static_cast<boost::uint64_t>(compute(j));
+        return static_cast<unsigned>(carry);
+    }
+
+    // Inverse of get_state, with the oldest element at x[k_].
+    void set_state(const boost::uint64_t* digits, unsigned carry_, std::size_t k_)
+    {
+        for(unsigned int j = 0; j < long_lag; ++j)
+            x[(k_ + j) % long_lag] = static_cast<IntType>(digits[j]);
+        carry = static_cast<IntType>(carry_);
+        k = k_;
+    }
+
     IntType do_update(std::size_t current, std::size_t short_index, IntType carry_)
     {
-        IntType delta;
+        // The borrow is unpredictable, so compute both cases without
+        // a branch: x(n) = x(n-s) - x(n-r) - c, plus the modulus if
+        // that is negative.
         IntType temp = x[current] + carry_;
-        if (x[short_index] >= temp) {
-            // x(n) >= 0
-            delta =  x[short_index] - temp;
-            carry_ = 0;
-        } else {
-            // x(n) < 0
-            delta = modulus - temp + x[short_index];
-            carry_ = 1;
-        }
-        x[current] = delta;
+        carry_ = static_cast<IntType>(x[short_index] < temp);
+        x[current] = static_cast<IntType>(
+            x[short_index] - temp + (modulus & (IntType(0) - carry_)));
         return carry_;
     }
     /// \endcond
@@ -498,17 +551,32 @@ private:
 
     friend struct detail::subtract_with_carry_discard;
 
+    // Copies the window as w-bit integers, oldest first, and returns
+    // the carry.  All values are exact multiples of 2^-w.
+    unsigned get_state(boost::uint64_t* digits) const
+    {
+        for(unsigned int j = 0; j < long_lag; ++j)
+            digits[j] = static_cast<boost::uint64_t>(compute(j) * _modulus);
+        return carry != 0 ? 1u : 0u;
+    }
+
+    // Inverse of get_state, with the oldest element at x[k_].
+    void set_state(const boost::uint64_t* digits, unsigned carry_, std::size_t k_)
+    {
+        for(unsigned int j = 0; j < long_lag; ++j)
+            x[(k_ + j) % long_lag] = static_cast<RealType>(digits[j]) / _modulus;
+        carry = carry_ ? RealType(1) / _modulus : RealType(0);
+        k = k_;
+    }
+
     RealType do_update(std::size_t current, std::size_t short_index, RealType carry_)
     {
+        // written as selects so that the unpredictable borrow
+        // does not become a branch
         RealType delta = x[short_index] - x[current] - carry_;
-        if(delta < 0) {
-            delta += RealType(1);
-            carry_ = RealType(1)/_modulus;
-        } else {
-            carry_ = 0;
-        }
-        x[current] = delta;
-        return carry_;
+        const RealType borrow = static_cast<RealType>(delta < 0);
+        x[current] = delta + borrow;
+        return borrow * (RealType(1) / _modulus);
     }
     /// \endcond
     std::size_t k;
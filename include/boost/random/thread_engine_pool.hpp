@@ -0,0 +1,174 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_THREAD_ENGINE_POOL_HPP
+#define BOOST_RANDOM_THREAD_ENGINE_POOL_HPP
+
+#include <boost/random/split_streams.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/throw_exception.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+namespace boost {
+namespace random {
+
+/**
+ * Hands out one engine per logical thread or task index, each in its
+ * own cache line.  The engine for index i is created on first use and
+ * is the same as @c split_streams(master, capacity())[i], so it depends
+ * only on the master seed and the index, not on which OS thread asks
+ * for it or in what order.
+ *
+ * @c get may be called concurrently.  Each engine must only be used by
+ * one thread at a time, which holds when every thread uses its own
+ * index.
+ *
+ * New engines are copied from a cursor that is advanced from the last
+ * index created, so creating the engines in increasing order of index
+ * costs one stream advance each.  An index below the cursor starts
+ * again from the master engine.  @c Engine must be one that
+ * @c split_streams accepts.
+ *
+ * @code
+ * boost::random::thread_engine_pool<boost::random::xoshiro256pp> pool(seed, n_tasks);
+ * // in task i, on any thread
+ * boost::random::xoshiro256pp& gen = pool.get(i);
+ * @endcode
+ */
+template<class Engine>
+class thread_engine_pool
+{
+    static_assert(detail::is_splittable<Engine>::value,
+                  "thread_engine_pool requires jump(), a jump_plan or a discard() that is faster than stepping");
+public:
+    typedef Engine engine_type;
+
+    /**
+     * Creates a pool for indices [0, capacity), with the master engine
+     * seeded by a @c seed_seq built from the two halves of @c seed.
+     */
+    thread_engine_pool(std::uint64_t seed, std::size_t capacity)
+      : _master(make_master(seed)), _splitter(capacity == 0 ? 1 : capacity),
+        _cursor(_master), _cursor_index(0)
+    {
+        allocate(capacity);
+    }
+
+    /**
+     * Creates a pool for indices [0, capacity) whose streams start from
+     * @c master.
+     */
+    thread_engine_pool(const Engine& master, std::size_t capacity)
+      : _master(master), _splitter(capacity == 0 ? 1 : capacity),
+        _cursor(_master), _cursor_index(0)
+    {
+        allocate(capacity);
+    }
+
+    thread_engine_pool(const thread_engine_pool&) = delete;
+    thread_engine_pool& operator=(const thread_engine_pool&) = delete;
+
+    ~thread_engine_pool()
+    {
+        for(std::size_t i = 0; i < _capacity; ++i) {
+            if(_slots[i].ready.load(std::memory_order_relaxed)) {
+                _slots[i].engine().~Engine();
+            }
+            _slots[i].~slot();
+        }
+        ::operator delete(_storage);
+    }
+
+    /** Returns the number of indices. */
+    std::size_t capacity() const noexcept { return _capacity; }
+
+    /** Returns the master engine that the streams are derived from. */
+    const Engine& master() const noexcept { return _master; }
+
+    /**
+     * Returns the engine for @c index, creating it on first use.
+     * Throws @c std::out_of_range if @c index is not less than
+     * @c capacity().
+     */
+    Engine& get(std::size_t index)
+    {
+        if(index >= _capacity) {
+            boost::throw_exception(std::out_of_range("thread_engine_pool: index out of range"));
+        }
+        slot& s = _slots[index];
+        if(!s.ready.load(std::memory_order_acquire)) {
+            std::call_once(s.once, [this, &s, index]() {
+                std::lock_guard<std::mutex> lock(_cursor_mutex);
+                if(index < _cursor_index) {
+                    _cursor = _master;
+                    _cursor_index = 0;
+                }
+                _splitter.advance(_cursor, index - _cursor_index);
+                _cursor_index = index;
+                ::new (static_cast<void*>(s.storage)) Engine(_cursor);
+                s.ready.store(true, std::memory_order_release);
+            });
+        }
+        return s.engine();
+    }
+
+private:
+    /// \cond show_private
+    struct alignas(BOOST_RANDOM_CACHE_LINE_SIZE) slot
+    {
+        slot() : ready(false) {}
+        Engine& engine() { return *reinterpret_cast<Engine*>(storage); }
+        alignas(Engine) unsigned char storage[sizeof(Engine)];
+        std::atomic<bool> ready;
+        std::once_flag once;
+    };
+
+    static Engine make_master(std::uint64_t seed)
+    {
+        seed_seq seq = {
+            static_cast<boost::uint32_t>(seed & 0xFFFFFFFFu),
+            static_cast<boost::uint32_t>(seed >> 32) };
+        return Engine(seq);
+    }
+
+    void allocate(std::size_t capacity)
+    {
+        const std::size_t align = alignof(slot);
+        _storage = ::operator new(capacity * sizeof(slot) + align - 1);
+        const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(_storage);
+        _slots = reinterpret_cast<slot*>((addr + align - 1) / align * align);
+        for(std::size_t i = 0; i < capacity; ++i) {
+            ::new (static_cast<void*>(_slots + i)) slot();
+        }
+        _capacity = capacity;
+    }
+    /// \endcond
+
+    Engine _master;
+    detail::stream_splitter<Engine> _splitter;
+    // the engine for _cursor_index, guarded by _cursor_mutex
+    Engine _cursor;
+    std::size_t _cursor_index;
+    std::mutex _cursor_mutex;
+    void* _storage;
+    slot* _slots;
+    std::size_t _capacity;
+};
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_THREAD_ENGINE_POOL_HPP
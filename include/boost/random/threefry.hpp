@@ -0,0 +1,563 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_THREEFRY_HPP
+#define BOOST_RANDOM_THREEFRY_HPP
+
+#include <boost/random/detail/config.hpp>
+#include <boost/random/detail/simd.hpp>
+#include <boost/random/splitmix64.hpp>
+#include <boost/throw_exception.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <ios>
+#include <istream>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// The Threefry-4x64 block function written once against the operations
+// in detail/simd.hpp.  With simd_u64_scalar it computes one block; with
+// a vector type each lane computes its own block, x[i] holding word i
+// of every lane.
+template <std::size_t Rounds>
+struct threefry4x64_rounds
+{
+    // rotation amounts from the Skein 1.3 specification
+    static constexpr int rotation(std::size_t r, std::size_t j)
+    {
+        return j == 0 ? (r == 0 ? 14 : r == 1 ? 52 : r == 2 ? 23 : r == 3 ? 5 :
+                         r == 4 ? 25 : r == 5 ? 46 : r == 6 ? 58 : 32)
+                      : (r == 0 ? 16 : r == 1 ? 57 : r == 2 ? 40 : r == 3 ? 37 :
+                         r == 4 ? 33 : r == 5 ? 12 : r == 6 ? 22 : 32);
+    }
+
+    template <typename V, int R>
+    static void mix(typename V::type& a, typename V::type& b)
+    {
+        a = V::add(a, b);
+        b = V::bxor(V::template rotl<R>(b), a);
+    }
+
+    template <typename V, std::size_t r>
+    static void round(typename V::type*, const typename V::type*, std::false_type)
+    {
+    }
+
+    template <typename V, std::size_t r>
+    static void round(typename V::type* x, const typename V::type* ks, std::true_type)
+    {
+        BOOST_IF_CONSTEXPR (r % 2 == 0)
+        {
+            mix<V, rotation(r % 8, 0)>(x[0], x[1]);
+            mix<V, rotation(r % 8, 1)>(x[2], x[3]);
+        }
+        else
+        {
+            mix<V, rotation(r % 8, 0)>(x[0], x[3]);
+            mix<V, rotation(r % 8, 1)>(x[2], x[1]);
+        }
+
+        BOOST_IF_CONSTEXPR (r % 4 == 3)
+        {
+            // key injection s = (r + 1) / 4
+            constexpr std::size_t s = (r + 1) / 4;
+            x[0] = V::add(x[0], ks[s % 5]);
+            x[1] = V::add(x[1], ks[(s + 1) % 5]);
+            x[2] = V::add(x[2], ks[(s + 2) % 5]);
+            x[3] = V::add(V::add(x[3], ks[(s + 3) % 5]), V::set1(s));
+        }
+
+        round<V, r + 1>(x, ks, std::integral_constant<bool, (r + 1 < Rounds)>());
+    }
+
+    // x holds the counter on entry and the output on exit; ks holds the
+    // four key words and their parity.
+    template <typename V>
+    static void apply(typename V::type* x, const typename V::type* ks)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            x[i] = V::add(x[i], ks[i]);
+        }
+
+        round<V, 0>(x, ks, std::true_type());
+    }
+};
+
+} // namespace detail
+
+/**
+ * Instantiations of class template @c threefry4x64_engine model a
+ * \pseudo_random_number_generator.  Threefry is the counter-based
+ * generator built from the Threefish block cipher described in
+ *
+ *  @blockquote
+ *  "Parallel random numbers: as easy as 1, 2, 3", John K. Salmon,
+ *  Mark A. Moraes, Ron O. Dror, and David E. Shaw, Proceedings of
+ *  the International Conference for High Performance Computing,
+ *  Networking, Storage and Analysis (SC '11), 2011.
+ *  @endblockquote
+ *
+ * Each block of four 64-bit outputs is a keyed bijection of a 256-bit
+ * counter.  @c discard() is O(1), @c set_key() selects one of 2^256
+ * streams and @c set_counter() seeks within it.  @c block() computes
+ * any block without an engine.
+ *
+ * @c generate() computes one block per 64-bit lane with AVX-512, AVX2 or
+ * SSE2 when the translation unit is compiled for them.  Define
+ * @c BOOST_RANDOM_NO_SIMD to force the portable loop.  The output does
+ * not depend on the instruction set.
+ */
+template <std::size_t Rounds>
+class threefry4x64_engine final
+{
+private:
+
+    static_assert(Rounds > 0, "threefry4x64_engine requires at least one round");
+
+    using rounds_type = detail::threefry4x64_rounds<Rounds>;
+    using simd_type = typename detail::simd_select_word<std::uint64_t>::type;
+    using scalar_type = detail::simd_u64_scalar;
+
+    static constexpr std::uint64_t parity = UINT64_C(0x1BD11BDAA9FC1A22);
+
+    // blocks produced per pass through the stack buffer of generate()
+    static constexpr std::size_t buffer_blocks = 64;
+
+public:
+
+    using result_type = std::uint64_t;
+    using seed_type = std::uint64_t;
+
+    /** The key of a stream, as taken by @c set_key. */
+    using key_type = std::array<std::uint64_t, 4>;
+
+    /** A counter, most significant word first, as taken by @c set_counter. */
+    using counter_type = std::array<std::uint64_t, 4>;
+
+    static constexpr std::size_t word_count = 4;
+    static constexpr std::size_t round_count = Rounds;
+    static constexpr bool has_fixed_range {false};
+
+private:
+
+    key_type key_;
+    std::array<std::uint64_t, 4> counter_;  // least significant word first
+    std::array<std::uint64_t, 4> output_;
+    std::size_t index_;
+
+    void reset_counter() noexcept
+    {
+        counter_.fill(0);
+        index_ = word_count - 1;
+    }
+
+    // Adds z to the 256-bit counter.
+    void increment(std::uint64_t z) noexcept
+    {
+        for (std::size_t j = 0; j < word_count && z != 0; ++j)
+        {
+            counter_[j] += z;
+            z = counter_[j] < z ? 1 : 0;
+        }
+    }
+
+    static void compute(const std::uint64_t* key, const std::uint64_t* counter, std::uint64_t* out) noexcept
+    {
+        std::uint64_t ks[5] = { key[0], key[1], key[2], key[3],
+                                parity ^ key[0] ^ key[1] ^ key[2] ^ key[3] };
+        std::uint64_t x[4] = { counter[0], counter[1], counter[2], counter[3] };
+        rounds_type::template apply<scalar_type>(x, ks);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            out[i] = x[i];
+        }
+    }
+
+    // Writes blocks whole blocks to out, one block per lane of V.
+    // Returns the number of blocks written.
+    template <typename V>
+    std::size_t run_blocks(std::uint64_t* out, std::size_t blocks, V) noexcept
+    {
+        using vec = typename V::type;
+        constexpr std::size_t lanes = V::width;
+
+        vec ks[5];
+        ks[4] = V::set1(parity);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            ks[i] = V::set1(key_[i]);
+            ks[4] = V::bxor(ks[4], ks[i]);
+        }
+
+        std::uint64_t offsets[lanes];
+        for (std::size_t l = 0; l < lanes; ++l)
+        {
+            offsets[l] = l;
+        }
+        const vec lane_offsets = V::load(offsets);
+
+        std::size_t b = 0;
+        for (; b + lanes <= blocks; b += lanes)
+        {
+            std::uint64_t buf[4][lanes];
+            vec x[4];
+            if (counter_[0] <= (std::numeric_limits<std::uint64_t>::max)() - lanes)
+            {
+                // no carry out of the low word within this batch
+                x[0] = V::add(V::set1(counter_[0]), lane_offsets);
+                for (std::size_t i = 1; i < 4; ++i)
+                {
+                    x[i] = V::set1(counter_[i]);
+                }
+                counter_[0] += lanes;
+            }
+            else
+            {
+                for (std::size_t l = 0; l < lanes; ++l)
+                {
+                    for (std::size_t i = 0; i < 4; ++i)
+                    {
+                        buf[i][l] = counter_[i];
+                    }
+                    increment(1);
+                }
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    x[i] = V::load(buf[i]);
+                }
+            }
+
+            rounds_type::template apply<V>(x, ks);
+
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                V::store(buf[i], x[i]);
+            }
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                for (std::size_t i = 0; i < 4; ++i)
+                {
+                    out[(b + l) * 4 + i] = buf[i][l];
+                }
+            }
+        }
+
+        return b;
+    }
+
+    std::size_t run_blocks(std::uint64_t*, std::size_t, detail::simd_none) noexcept
+    {
+        return 0;
+    }
+
+    void generate_blocks(std::uint64_t* out, std::size_t blocks) noexcept
+    {
+        std::size_t b = run_blocks(out, blocks, simd_type());
+        for (; b < blocks; ++b)
+        {
+            compute(key_.data(), counter_.data(), out + b * 4);
+            increment(1);
+        }
+    }
+
+public:
+
+    /** Seeds the key using the default seed of boost::random::splitmix64. */
+    void seed()
+    {
+        splitmix64 gen;
+        for (auto& k : key_)
+        {
+            k = gen();
+        }
+        reset_counter();
+    }
+
+    /** Seeds the key from a splitmix64 seeded with @c value. */
+    void seed(const seed_type value)
+    {
+        splitmix64 gen(value);
+        for (auto& k : key_)
+        {
+            k = gen();
+        }
+        reset_counter();
+    }
+
+    /**
+     * Seeds the key with 32-bit values produced by @c seq.generate(),
+     * two per key word.
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    void seed(Sseq& seq)
+    {
+        std::array<std::uint32_t, 8> seeds;
+        seq.generate(seeds.begin(), seeds.end());
+        for (std::size_t i = 0; i < key_.size(); ++i)
+        {
+            key_[i] = static_cast<std::uint64_t>(seeds[2*i]) << 32U | seeds[2*i + 1];
+        }
+        reset_counter();
+    }
+
+    /** Sets the key using values from an iterator range. */
+    template <typename FIter>
+    void seed(FIter first, FIter last)
+    {
+        static_assert(std::is_integral<typename std::iterator_traits<FIter>::value_type>::value,
+                      "Value type must be a built-in integer type" );
+
+        std::size_t offset = 0;
+        while (first != last && offset < key_.size())
+        {
+            key_[offset++] = static_cast<std::uint64_t>(*first++);
+        }
+
+        if (offset != key_.size())
+        {
+            boost::throw_exception(std::invalid_argument("Not enough elements in call to seed."));
+        }
+
+        reset_counter();
+    }
+
+    /** Constructs a @c threefry4x64_engine and calls @c seed(). */
+    threefry4x64_engine() { seed(); }
+
+    /** Constructs a @c threefry4x64_engine and calls @c seed(value). */
+    explicit threefry4x64_engine(const seed_type value) { seed(value); }
+
+    template <typename FIter>
+    threefry4x64_engine(FIter& first, FIter last) { seed(first, last); }
+
+    /**
+     * Constructs a @c threefry4x64_engine and calls @c seed(seq).
+     *
+     * @xmlnote
+     * The copy constructor will always be preferred over
+     * the templated constructor.
+     * @endxmlnote
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, threefry4x64_engine>::value, bool>::type = true>
+    explicit threefry4x64_engine(Sseq& seq) { seed(seq); }
+
+    /** Sets the key and resets the counter to zero. */
+    void set_key(const key_type& key) noexcept
+    {
+        key_ = key;
+        reset_counter();
+    }
+
+    /**
+     * Sets the counter.  counter[3] is the least significant word.  The
+     * next four values are the block computed from this counter.
+     */
+    void set_counter(const counter_type& counter) noexcept
+    {
+        for (std::size_t i = 0; i < word_count; ++i)
+        {
+            counter_[i] = counter[word_count - 1 - i];
+        }
+        index_ = word_count - 1;
+    }
+
+    /**
+     * Returns the four values produced by an engine after
+     * @c set_key(key) and @c set_counter(counter).
+     */
+    static std::array<result_type, 4> block(const key_type& key, const counter_type& counter) noexcept
+    {
+        const std::uint64_t x[4] = { counter[3], counter[2], counter[1], counter[0] };
+        std::array<result_type, 4> result;
+        compute(key.data(), x, result.data());
+        return result;
+    }
+
+    /** Returns the next value of the generator. */
+    inline result_type operator()() noexcept
+    {
+        if (++index_ == word_count)
+        {
+            compute(key_.data(), counter_.data(), output_.data());
+            increment(1);
+            index_ = 0;
+        }
+
+        return output_[index_];
+    }
+
+    /** Fills a range with random values. */
+    template <typename FIter>
+    void generate(FIter first, FIter last)
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        while (first != last && index_ != word_count - 1)
+        {
+            *first++ = static_cast<iter_type>((*this)());
+        }
+
+        std::uint64_t buffer[buffer_blocks * word_count];
+        std::size_t blocks = static_cast<std::size_t>(std::distance(first, last)) / word_count;
+        while (blocks != 0)
+        {
+            const std::size_t count = (std::min)(blocks, buffer_blocks);
+            generate_blocks(buffer, count);
+            for (std::size_t i = 0; i < count * word_count; ++i)
+            {
+                *first++ = static_cast<iter_type>(buffer[i]);
+            }
+            blocks -= count;
+        }
+
+        while (first != last)
+        {
+            *first++ = static_cast<iter_type>((*this)());
+        }
+    }
+
+    /** Fills a contiguous range with random values, writing whole blocks in place. */
+    void generate(std::uint64_t* first, std::uint64_t* last) noexcept
+    {
+        while (first != last && index_ != word_count - 1)
+        {
+            *first++ = (*this)();
+        }
+
+        const std::size_t blocks = static_cast<std::size_t>(last - first) / word_count;
+        generate_blocks(first, blocks);
+        first += blocks * word_count;
+
+        while (first != last)
+        {
+            *first++ = (*this)();
+        }
+    }
+
+    /** Advances the state of the generator by @c z values in O(1) time. */
+    void discard(std::uint64_t z) noexcept
+    {
+        const std::uint64_t offset = z % word_count + index_;
+        const std::uint64_t blocks = z / word_count + offset / word_count;
+        if (blocks != 0)
+        {
+            increment(blocks - 1);
+            compute(key_.data(), counter_.data(), output_.data());
+            increment(1);
+        }
+        index_ = static_cast<std::size_t>(offset % word_count);
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    friend bool operator==(const threefry4x64_engine& lhs, const threefry4x64_engine& rhs) noexcept
+    {
+        return lhs.key_ == rhs.key_ && lhs.counter_ == rhs.counter_ && lhs.index_ == rhs.index_;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    friend bool operator!=(const threefry4x64_engine& lhs, const threefry4x64_engine& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /** Writes the key, the counter and the position in the current block to a @c std::ostream. */
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& ost,
+                                                         const threefry4x64_engine& e)
+    {
+        for (std::size_t i = 0; i < e.key_.size(); ++i)
+        {
+            ost << e.key_[i] << ' ';
+        }
+        for (std::size_t i = 0; i < e.counter_.size(); ++i)
+        {
+            ost << e.counter_[i] << ' ';
+        }
+        ost << e.index_;
+
+        return ost;
+    }
+
+    /** Reads a @c threefry4x64_engine from a @c std::istream. */
+    template <typename CharT, typename Traits>
+    friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& ist,
+                                                         threefry4x64_engine& e)
+    {
+        threefry4x64_engine tmp;
+        for (std::size_t i = 0; i < tmp.key_.size(); ++i)
+        {
+            ist >> tmp.key_[i] >> std::ws;
+        }
+        for (std::size_t i = 0; i < tmp.counter_.size(); ++i)
+        {
+            ist >> tmp.counter_[i] >> std::ws;
+        }
+        ist >> tmp.index_;
+
+        if (ist && tmp.index_ >= word_count)
+        {
+            ist.setstate(std::ios_base::failbit);
+        }
+
+        if (ist)
+        {
+            // the current block came from the previous counter
+            if (tmp.index_ != word_count - 1)
+            {
+                std::array<std::uint64_t, 4> prev = tmp.counter_;
+                for (std::size_t i = 0; i < prev.size() && prev[i]-- == 0; ++i)
+                {
+                }
+                compute(tmp.key_.data(), prev.data(), tmp.output_.data());
+            }
+            e = tmp;
+        }
+
+        return ist;
+    }
+
+    /** Returns the smallest value that the generator can produce. */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<result_type>::min)();
+    }
+
+    /** Returns the largest value that the generator can produce. */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+};
+
+/** Threefry-4x64 with 20 rounds, the default of Random123. */
+using threefry4x64 = threefry4x64_engine<20>;
+
+/** Threefry-4x64 with 13 rounds, faster with a smaller safety margin. */
+using threefry4x64_13 = threefry4x64_engine<13>;
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_THREEFRY_HPP
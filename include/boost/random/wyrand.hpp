@@ -0,0 +1,203 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_WYRAND_HPP
+#define BOOST_RANDOM_WYRAND_HPP
+
+#include <boost/random/detail/large_arithmetic.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <ios>
+#include <istream>
+#include <type_traits>
+#include <iterator>
+
+namespace boost { namespace random {
+
+/**
+ * This is Wang Yi's wyrand generator from wyhash (final version 4).  The
+ * state is a single 64-bit Weyl sequence and each output is the folded
+ * 128-bit product of two functions of it, so it is among the fastest
+ * generators on targets with a 64x64->128 bit multiply.  The period is
+ * 2^64 and every seed is valid.
+ *
+ * Because the state is a Weyl sequence, @c discard() takes constant time.
+ */
+class wyrand
+{
+private:
+    std::uint64_t state_;
+
+    static constexpr std::uint64_t increment = UINT64_C(0x2d358dccaa6c78a5);
+    static constexpr std::uint64_t mix = UINT64_C(0x8bb84b93962eacc9);
+
+    static inline std::uint64_t concatenate(std::uint32_t word1, std::uint32_t word2) noexcept
+    {
+        return static_cast<std::uint64_t>(word1) << 32 | word2;
+    }
+
+    static inline std::uint64_t step(std::uint64_t& s) noexcept
+    {
+        s += increment;
+        std::uint64_t hi;
+        const std::uint64_t lo = detail::umul128(s, s ^ mix, hi);
+        return lo ^ hi;
+    }
+
+public:
+    using result_type = std::uint64_t;
+    using seed_type = std::uint64_t;
+
+    // Required for old Boost.Random concept
+    static constexpr bool has_fixed_range {false};
+
+    /** Seeds the generator with a user provided seed. */
+    void seed(const seed_type value = 0) noexcept
+    {
+        state_ = value;
+    }
+
+    /**
+     * Seeds the generator with 32-bit values produced by @c seq.generate().
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    void seed(Sseq& seq)
+    {
+        std::array<std::uint32_t, 2> seeds;
+        seq.generate(seeds.begin(), seeds.end());
+
+        state_ = concatenate(seeds[0], seeds[1]);
+    }
+
+    /** Seeds the generator with a user provided seed. */
+    explicit wyrand(const seed_type value = 0) noexcept
+    {
+        seed(value);
+    }
+
+    /**
+     * Seeds the generator with 32-bit values produced by @c seq.generate().
+     *
+     * @xmlnote
+     * The copy constructor will always be preferred over
+     * the templated constructor.
+     * @endxmlnote
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, wyrand>::value &&
+                                                     !std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    explicit wyrand(Sseq& seq)
+    {
+        seed(seq);
+    }
+
+    wyrand(const wyrand& other) = default;
+    wyrand& operator=(const wyrand& other) = default;
+
+    /**  Returns the next value of the generator. */
+    inline result_type next() noexcept
+    {
+        return step(state_);
+    }
+
+    /**  Returns the next value of the generator. */
+    inline result_type operator()() noexcept
+    {
+        return next();
+    }
+
+    /** Advances the state of the generator by @c z. */
+    inline void discard(std::uint64_t z) noexcept
+    {
+        state_ += z * increment;
+    }
+
+    /**
+     * Fills a range with random values.  The state is kept in a local for
+     * the whole range so that stores to the output do not force it back
+     * to memory on every step.
+     */
+    template <typename FIter>
+    inline void generate(FIter first, FIter last) noexcept
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        std::uint64_t s = state_;
+        while (first != last)
+        {
+            *first++ = static_cast<iter_type>(step(s));
+        }
+        state_ = s;
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    inline friend bool operator==(const wyrand& lhs, const wyrand& rhs) noexcept
+    {
+        return lhs.state_ == rhs.state_;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    inline friend bool operator!=(const wyrand& lhs, const wyrand& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /**  Writes a @c wyrand to a @c std::ostream. */
+    template <typename CharT, typename Traits>
+    inline friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& ost,
+                                                                const wyrand& e)
+    {
+        ost << e.state_;
+        return ost;
+    }
+
+    /**  Reads a @c wyrand from a @c std::istream. */
+    template <typename CharT, typename Traits>
+    inline friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& ist,
+                                                                wyrand& e)
+    {
+        ist >> e.state_ >> std::ws;
+        return ist;
+    }
+
+    /**
+     * Returns the largest value that the @c wyrand
+     * can produce.
+     */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<std::uint64_t>::max)();
+    }
+
+    /**
+     * Returns the smallest value that the @c wyrand
+     * can produce.
+     */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<std::uint64_t>::min)();
+    }
+
+    inline std::uint64_t state() const noexcept
+    {
+        return state_;
+    }
+};
+
+}} // Namespace boost::random
+
+#endif // BOOST_RANDOM_WYRAND_HPP
@@ -0,0 +1,505 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org for most recent version including documentation.
+ *
+ * $Id$
+ */
+
+#ifndef BOOST_RANDOM_XOSHIRO_LANES_HPP
+#define BOOST_RANDOM_XOSHIRO_LANES_HPP
+
+#include <boost/random/detail/config.hpp>
+#include <boost/random/detail/simd.hpp>
+#include <boost/random/xoshiro.hpp>
+#include <boost/throw_exception.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <ios>
+#include <istream>
+
+namespace boost {
+namespace random {
+namespace detail {
+
+// Describes one step of a 64-bit xoshiro engine in terms of the
+// operations in detail/simd.hpp, so that the same definition drives the
+// scalar single-lane path and the vector kernels.  s points to the state
+// words of one lane (or of one vector of lanes).
+template <typename Engine>
+struct xoshiro_lane_traits;
+
+template <>
+struct xoshiro_lane_traits<xoshiro256pp>
+{
+    static constexpr std::size_t words = 4;
+
+    template <typename V>
+    static typename V::type output(const typename V::type* s)
+    {
+        return V::add(V::template rotl<23>(V::add(s[0], s[3])), s[0]);
+    }
+
+    template <typename V>
+    static void step(typename V::type* s)
+    {
+        const typename V::type t = V::template shl<17>(s[1]);
+        s[2] = V::bxor(s[2], s[0]);
+        s[3] = V::bxor(s[3], s[1]);
+        s[1] = V::bxor(s[1], s[2]);
+        s[0] = V::bxor(s[0], s[3]);
+        s[2] = V::bxor(s[2], t);
+        s[3] = V::template rotl<45>(s[3]);
+    }
+};
+
+template <>
+struct xoshiro_lane_traits<xoshiro256mm>
+{
+    static constexpr std::size_t words = 4;
+
+    template <typename V>
+    static typename V::type output(const typename V::type* s)
+    {
+        // rotl(s[1] * 5, 7) * 9 without a 64-bit vector multiply
+        const typename V::type x = V::add(V::template shl<2>(s[1]), s[1]);
+        const typename V::type r = V::template rotl<7>(x);
+        return V::add(V::template shl<3>(r), r);
+    }
+
+    template <typename V>
+    static void step(typename V::type* s)
+    {
+        xoshiro_lane_traits<xoshiro256pp>::step<V>(s);
+    }
+};
+
+template <>
+struct xoshiro_lane_traits<xoshiro512pp>
+{
+    static constexpr std::size_t words = 8;
+
+    template <typename V>
+    static typename V::type output(const typename V::type* s)
+    {
+        return V::add(V::template rotl<17>(V::add(s[0], s[2])), s[2]);
+    }
+
+    template <typename V>
+    static void step(typename V::type* s)
+    {
+        const typename V::type t = V::template shl<11>(s[1]);
+        s[2] = V::bxor(s[2], s[0]);
+        s[5] = V::bxor(s[5], s[1]);
+        s[1] = V::bxor(s[1], s[2]);
+        s[7] = V::bxor(s[7], s[3]);
+        s[3] = V::bxor(s[3], s[4]);
+        s[4] = V::bxor(s[4], s[5]);
+        s[0] = V::bxor(s[0], s[6]);
+        s[6] = V::bxor(s[6], s[7]);
+        s[6] = V::bxor(s[6], t);
+        s[7] = V::template rotl<21>(s[7]);
+    }
+};
+
+template <>
+struct xoshiro_lane_traits<xoshiro512mm>
+{
+    static constexpr std::size_t words = 8;
+
+    template <typename V>
+    static typename V::type output(const typename V::type* s)
+    {
+        return xoshiro_lane_traits<xoshiro256mm>::output<V>(s);
+    }
+
+    template <typename V>
+    static void step(typename V::type* s)
+    {
+        xoshiro_lane_traits<xoshiro512pp>::step<V>(s);
+    }
+};
+
+} // namespace detail
+
+/**
+ * Runs @c Lanes independent copies of a 64-bit xoshiro engine side by side
+ * so that bulk generation can be done with vector instructions.
+ *
+ * Lane i starts from the state of an @c Engine seeded with the same
+ * arguments and then advanced by i calls to @c Engine::jump(), so the
+ * lanes are 2^128 (xoshiro256) or 2^256 (xoshiro512) steps apart and never
+ * overlap.  The output is interleaved round-robin: the k-th value returned
+ * is the (k / Lanes)-th output of lane (k % Lanes).  In particular lane 0
+ * reproduces the sequence of a plain @c Engine with the same seed, and the
+ * sequence does not depend on the instruction set used to produce it.
+ *
+ * The state is stored word-major (all lanes of word 0, then word 1, ...)
+ * and @c generate() uses AVX-512, AVX2 or SSE2 kernels when the translation
+ * unit is compiled for them, falling back to a portable loop otherwise.
+ * Define @c BOOST_RANDOM_NO_SIMD to force the portable loop.
+ *
+ * Supported engines are @c xoshiro256pp, @c xoshiro256mm, @c xoshiro512pp
+ * and @c xoshiro512mm.
+ */
+template <typename Engine, std::size_t Lanes>
+class xoshiro_lanes
+{
+private:
+
+    static_assert(Lanes > 0, "xoshiro_lanes requires at least one lane");
+
+    using traits_type = detail::xoshiro_lane_traits<Engine>;
+    using simd_type = typename detail::simd_u64_select<Lanes>::type;
+    using scalar_type = detail::simd_u64_scalar;
+
+    static constexpr std::size_t words = traits_type::words;
+
+    // number of steps per lane produced by one pass of generate()
+    // through its stack buffer when the destination is not contiguous.
+    static constexpr std::size_t buffer_steps = (Lanes < 64U ? 256U / Lanes : 1U);
+
+    alignas(64) std::array<std::uint64_t, words * Lanes> state_;
+    std::size_t lane_;
+
+    void lane_state(std::size_t lane, std::uint64_t* s) const noexcept
+    {
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            s[w] = state_[w * Lanes + lane];
+        }
+    }
+
+    void set_lanes(Engine gen) noexcept
+    {
+        for (std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const std::array<std::uint64_t, words> s = gen.state();
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                state_[w * Lanes + lane] = s[w];
+            }
+            gen.jump();
+        }
+        lane_ = 0;
+    }
+
+    // Advances every lane by steps and, if out is not null, stores the
+    // outputs interleaved as described in the class documentation.
+    void run_lanes(std::uint64_t* out, std::size_t steps) noexcept
+    {
+        using V = simd_type;
+        for (std::size_t c = 0; c < Lanes; c += V::width)
+        {
+            typename V::type s[words];
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                s[w] = V::load(&state_[w * Lanes + c]);
+            }
+
+            if (out != nullptr)
+            {
+                for (std::size_t i = 0; i < steps; ++i)
+                {
+                    V::store(out + i * Lanes + c, traits_type::template output<V>(s));
+                    traits_type::template step<V>(s);
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < steps; ++i)
+                {
+                    traits_type::template step<V>(s);
+                }
+            }
+
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                V::store(&state_[w * Lanes + c], s[w]);
+            }
+        }
+    }
+
+public:
+
+    using result_type = std::uint64_t;
+    using seed_type = std::uint64_t;
+    using engine_type = Engine;
+
+    static constexpr std::size_t lane_count = Lanes;
+    static constexpr bool has_fixed_range {false};
+
+    /** Seeds every lane from a default constructed @c Engine. */
+    void seed()
+    {
+        set_lanes(Engine());
+    }
+
+    /** Seeds every lane from @c Engine(value). */
+    void seed(const seed_type value)
+    {
+        set_lanes(Engine(value));
+    }
+
+    /** Seeds every lane from an @c Engine constructed from @c seq. */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, seed_type>::value, bool>::type = true>
+    void seed(Sseq& seq)
+    {
+        set_lanes(Engine(seq));
+    }
+
+    /**
+     * Sets the state of every lane from an iterator range, lane by lane,
+     * in the same order used by the stream operators.
+     */
+    template <typename FIter>
+    void seed(FIter first, FIter last)
+    {
+        static_assert(std::is_integral<typename std::iterator_traits<FIter>::value_type>::value,
+                      "Value type must be a built-in integer type" );
+
+        std::size_t offset = 0;
+        while (first != last && offset < state_.size())
+        {
+            state_[(offset % words) * Lanes + offset / words] = static_cast<std::uint64_t>(*first++);
+            ++offset;
+        }
+
+        if (offset != state_.size())
+        {
+            boost::throw_exception(std::invalid_argument("Not enough elements in call to seed."));
+        }
+
+        lane_ = 0;
+    }
+
+    /** Constructs a @c xoshiro_lanes and calls @c seed(). */
+    xoshiro_lanes() { seed(); }
+
+    /** Constructs a @c xoshiro_lanes and calls @c seed(value). */
+    explicit xoshiro_lanes(const seed_type value) { seed(value); }
+
+    template <typename FIter>
+    xoshiro_lanes(FIter& first, FIter last) { seed(first, last); }
+
+    /**
+     * Constructs a @c xoshiro_lanes and calls @c seed(seq).
+     *
+     * @xmlnote
+     * The copy constructor will always be preferred over
+     * the templated constructor.
+     * @endxmlnote
+     */
+    template <typename Sseq, typename std::enable_if<!std::is_convertible<Sseq, xoshiro_lanes>::value, bool>::type = true>
+    explicit xoshiro_lanes(Sseq& seq) { seed(seq); }
+
+    /** Returns the next value of the generator. */
+    inline result_type operator()() noexcept
+    {
+        std::uint64_t s[words];
+        lane_state(lane_, s);
+        const result_type result = traits_type::template output<scalar_type>(s);
+
+        if (++lane_ == Lanes)
+        {
+            run_lanes(nullptr, 1U);
+            lane_ = 0;
+        }
+
+        return result;
+    }
+
+    /** Fills a range with random values. */
+    template <typename FIter>
+    void generate(FIter first, FIter last)
+    {
+        using iter_type = typename std::iterator_traits<FIter>::value_type;
+
+        while (first != last && lane_ != 0)
+        {
+            *first++ = static_cast<iter_type>((*this)());
+        }
+
+        std::uint64_t buffer[buffer_steps * Lanes];
+        std::size_t remaining = static_cast<std::size_t>(std::distance(first, last));
+        while (remaining >= Lanes)
+        {
+            const std::size_t steps = (std::min)(remaining / Lanes, buffer_steps);
+            run_lanes(buffer, steps);
+            for (std::size_t i = 0; i < steps * Lanes; ++i)
+            {
+                *first++ = static_cast<iter_type>(buffer[i]);
+            }
+            remaining -= steps * Lanes;
+        }
+
+        while (first != last)
+        {
+            *first++ = static_cast<iter_type>((*this)());
+        }
+    }
+
+    /** Fills a contiguous range with random values, writing whole blocks in place. */
+    void generate(std::uint64_t* first, std::uint64_t* last) noexcept
+    {
+        while (first != last && lane_ != 0)
+        {
+            *first++ = (*this)();
+        }
+
+        const std::size_t steps = static_cast<std::size_t>(last - first) / Lanes;
+        run_lanes(first, steps);
+        first += steps * Lanes;
+
+        while (first != last)
+        {
+            *first++ = (*this)();
+        }
+    }
+
+    /** Advances the state of the generator by @c z values. */
+    void discard(std::uint64_t z)
+    {
+        while (z != 0 && lane_ != 0)
+        {
+            (*this)();
+            --z;
+        }
+
+        std::uint64_t steps = z / Lanes;
+        if (steps > BOOST_RANDOM_XOSHIRO_DISCARD_THRESHOLD)
+        {
+            // jump every lane independently using Engine's jump-ahead
+            for (std::size_t lane = 0; lane < Lanes; ++lane)
+            {
+                std::array<std::uint64_t, words> s;
+                lane_state(lane, s.data());
+                Engine gen;
+                gen.seed(s.begin(), s.end());
+                gen.discard(steps);
+                s = gen.state();
+                for (std::size_t w = 0; w < words; ++w)
+                {
+                    state_[w * Lanes + lane] = s[w];
+                }
+            }
+        }
+        else if (steps != 0)
+        {
+            run_lanes(nullptr, static_cast<std::size_t>(steps));
+        }
+
+        for (z %= Lanes; z != 0; --z)
+        {
+            (*this)();
+        }
+    }
+
+    /**
+     * Returns true if the two generators will produce identical
+     * sequences of values.
+     */
+    friend bool operator==(const xoshiro_lanes& lhs, const xoshiro_lanes& rhs) noexcept
+    {
+        return lhs.lane_ == rhs.lane_ && lhs.state_ == rhs.state_;
+    }
+
+    /**
+     * Returns true if the two generators will produce different
+     * sequences of values.
+     */
+    friend bool operator!=(const xoshiro_lanes& lhs, const xoshiro_lanes& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /** Writes a @c xoshiro_lanes to a @c std::ostream. */
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& ost,
+                                                         const xoshiro_lanes& e)
+    {
+        for (std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                ost << e.state_[w * Lanes + lane] << ' ';
+            }
+        }
+        ost << e.lane_;
+
+        return ost;
+    }
+
+    /**
+     * Reads a @c xoshiro_lanes from a @c std::istream.  If the lane
+     * index read is not less than @c Lanes, sets @c failbit and leaves
+     * the engine unchanged.
+     */
+    template <typename CharT, typename Traits>
+    friend std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& ist,
+                                                         xoshiro_lanes& e)
+    {
+        std::array<std::uint64_t, words * Lanes> state;
+        std::size_t lane_index = 0;
+        for (std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                ist >> state[w * Lanes + lane] >> std::ws;
+            }
+        }
+        ist >> lane_index;
+
+        if (ist)
+        {
+            if (lane_index < Lanes)
+            {
+                e.state_ = state;
+                e.lane_ = lane_index;
+            }
+            else
+            {
+                ist.setstate(std::ios_base::failbit);
+            }
+        }
+
+        return ist;
+    }
+
+    /** Returns the smallest value that the generator can produce. */
+    static constexpr result_type (min)() noexcept
+    {
+        return (std::numeric_limits<result_type>::min)();
+    }
+
+    /** Returns the largest value that the generator can produce. */
+    static constexpr result_type (max)() noexcept
+    {
+        return (std::numeric_limits<result_type>::max)();
+    }
+};
+
+/** Four interleaved @c xoshiro256pp lanes, one AVX2 vector wide. */
+using xoshiro256pp_x4 = xoshiro_lanes<xoshiro256pp, 4>;
+
+/** Eight interleaved @c xoshiro256pp lanes, one AVX-512 vector wide. */
+using xoshiro256pp_x8 = xoshiro_lanes<xoshiro256pp, 8>;
+
+/** Four interleaved @c xoshiro512pp lanes, one AVX2 vector wide. */
+using xoshiro512pp_x4 = xoshiro_lanes<xoshiro512pp, 4>;
+
+/** Eight interleaved @c xoshiro512pp lanes, one AVX-512 vector wide. */
+using xoshiro512pp_x8 = xoshiro_lanes<xoshiro512pp, 8>;
+
+} // namespace random
+} // namespace boost
+
+#endif // BOOST_RANDOM_XOSHIRO_LANES_HPP
@@ -0,0 +1,75 @@
+/* boost discard_speed.cpp performance measurements
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ * Measures the polynomial jump-ahead used by discard() for long
+ * jumps.  Build once with and once without carry-less multiply
+ * support (e.g. -mpclmul, or -DBOOST_RANDOM_NO_SIMD) to compare
+ * the backends.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <boost/cstdint.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/detail/config.hpp>
+
+template<class Engine>
+void run_discard(int iter, boost::uintmax_t z, const std::string& name)
+{
+    Engine gen;
+    // The first jump also computes the characteristic polynomial.
+    gen.discard(z);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iter; ++i) {
+        gen.discard(z + i);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << " discard(" << z << "): "
+              << elapsed.count() / iter << " us" << std::endl;
+}
+
+template<class Engine>
+void run_jump_plan(int iter, boost::uintmax_t z, const std::string& name)
+{
+    Engine gen;
+    typename Engine::jump_plan plan(z);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iter; ++i) {
+        plan.apply(gen);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << " jump_plan(" << z << ").apply: "
+              << elapsed.count() / iter << " us" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    int iter = 100;
+    if(argc >= 2) {
+        iter = std::atoi(argv[1]);
+    }
+
+#ifdef BOOST_RANDOM_HAS_PCLMUL
+    std::cout << "polynomial backend: pclmulqdq" << std::endl;
+#else
+    std::cout << "polynomial backend: portable" << std::endl;
+#endif
+
+    const boost::uintmax_t distances[] = {
+        UINTMAX_C(1) << 24, UINTMAX_C(1) << 40, ~UINTMAX_C(0) >> 1
+    };
+    for(std::size_t i = 0; i < sizeof(distances)/sizeof(distances[0]); ++i) {
+        run_discard<boost::random::mt19937>(iter, distances[i], "mt19937");
+        run_discard<boost::random::mt19937_64>(iter, distances[i], "mt19937_64");
+    }
+    run_jump_plan<boost::random::mt19937>(iter, UINTMAX_C(1) << 40, "mt19937");
+    run_jump_plan<boost::random::mt19937_64>(iter, UINTMAX_C(1) << 40, "mt19937_64");
+}
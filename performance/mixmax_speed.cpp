@@ -0,0 +1,122 @@
+/* boost mixmax_speed.cpp performance measurements
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ * Compares mixmax with mt19937 for single values, bulk generation,
+ * seeding and long jumps.  Build once with and once without vector
+ * support (e.g. -mavx2, or -DBOOST_RANDOM_NO_SIMD) to compare the
+ * backends used for the state multiply-accumulate.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/random/mixmax.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/detail/config.hpp>
+
+typedef std::chrono::steady_clock clock_type;
+
+template<class Engine>
+void run_call(int iter, const std::string& name)
+{
+    Engine gen;
+    boost::uint64_t sum = 0;
+    clock_type::time_point start = clock_type::now();
+    for(int i = 0; i < iter; ++i) {
+        sum += gen();
+    }
+    std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+    std::cout << name << " operator(): " << elapsed.count() / iter << " ns"
+              << " (" << (sum & 1) << ")" << std::endl;
+}
+
+template<class Engine>
+void run_generate(int iter, const std::string& name)
+{
+    Engine gen;
+    std::vector<boost::uint32_t> buf(1024);
+    const int rounds = iter / static_cast<int>(buf.size()) + 1;
+    clock_type::time_point start = clock_type::now();
+    for(int i = 0; i < rounds; ++i) {
+        gen.generate(buf.begin(), buf.end());
+    }
+    std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+    std::cout << name << " generate: " << elapsed.count() / (rounds * buf.size())
+              << " ns/word (" << (buf[0] & 1) << ")" << std::endl;
+}
+
+template<class Engine>
+void run_seed(int iter, const std::string& name)
+{
+    Engine gen;
+    boost::uint64_t sum = 0;
+    clock_type::time_point start = clock_type::now();
+    for(int i = 0; i < iter; ++i) {
+        gen.seed(static_cast<boost::uint32_t>(i + 1));
+        sum += gen();
+    }
+    std::chrono::duration<double, std::micro> elapsed = clock_type::now() - start;
+    std::cout << name << " seed: " << elapsed.count() / iter << " us"
+              << " (" << (sum & 1) << ")" << std::endl;
+}
+
+template<class Engine>
+void run_discard(int iter, boost::uintmax_t z, const std::string& name)
+{
+    Engine gen;
+    // The first jump may compute the characteristic polynomial.
+    gen.discard(z);
+    clock_type::time_point start = clock_type::now();
+    for(int i = 0; i < iter; ++i) {
+        gen.discard(z + i);
+    }
+    std::chrono::duration<double, std::micro> elapsed = clock_type::now() - start;
+    std::cout << name << " discard(" << z << "): "
+              << elapsed.count() / iter << " us" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    int iter = 10000000;
+    if(argc >= 2) {
+        iter = std::atoi(argv[1]);
+    }
+
+#if defined(BOOST_RANDOM_HAS_AVX512)
+    std::cout << "vector backend: avx512" << std::endl;
+#elif defined(BOOST_RANDOM_HAS_AVX2)
+    std::cout << "vector backend: avx2" << std::endl;
+#elif defined(BOOST_RANDOM_HAS_SSE2)
+    std::cout << "vector backend: sse2" << std::endl;
+#else
+    std::cout << "vector backend: scalar" << std::endl;
+#endif
+
+    run_call<boost::random::mixmax>(iter, "mixmax");
+    run_call<boost::random::mt19937>(iter, "mt19937");
+    run_call<boost::random::mt19937_64>(iter, "mt19937_64");
+
+    run_generate<boost::random::mixmax>(iter, "mixmax");
+    run_generate<boost::random::mt19937>(iter, "mt19937");
+    run_generate<boost::random::mt19937_64>(iter, "mt19937_64");
+
+    run_seed<boost::random::mixmax>(iter / 1000, "mixmax");
+    run_seed<boost::random::mt19937>(iter / 1000, "mt19937");
+
+    const boost::uintmax_t distances[] = {
+        UINTMAX_C(1) << 24, UINTMAX_C(1) << 40, ~UINTMAX_C(0) >> 1
+    };
+    for(std::size_t i = 0; i < sizeof(distances)/sizeof(distances[0]); ++i) {
+        run_discard<boost::random::mixmax>(iter / 100000, distances[i], "mixmax");
+        run_discard<boost::random::mt19937>(iter / 100000, distances[i], "mt19937");
+    }
+}
@@ -391,6 +391,27 @@ int main(int argc, char*argv[])
   run(iter, "xoshiro128pp", boost::random::xoshiro128pp());
   run(iter, "xoshiro128f", boost::random::xoshiro128f());
   run(iter, "xoshiro128mm", boost::random::xoshiro128mm());
+  run(iter, "xoshiro256pp_x4", boost::random::xoshiro256pp_x4());
+  run(iter, "xoshiro256pp_x8", boost::random::xoshiro256pp_x8());
+  run(iter, "xoshiro512pp_x4", boost::random::xoshiro512pp_x4());
+  run(iter, "xoshiro512pp_x8", boost::random::xoshiro512pp_x8());
+  run(iter, "philox4x32", boost::random::philox4x32());
+  run(iter, "philox4x64", boost::random::philox4x64());
+  run(iter, "threefry4x64", boost::random::threefry4x64());
+  run(iter, "chacha8", boost::random::chacha8());
+  run(iter, "chacha12", boost::random::chacha12());
+  run(iter, "chacha20", boost::random::chacha20());
+  run(iter, "pcg32", boost::random::pcg32());
+  run(iter, "pcg32_oneseq", boost::random::pcg32_oneseq());
+  run(iter, "pcg32_fast", boost::random::pcg32_fast());
+  run(iter, "pcg64", boost::random::pcg64());
+  run(iter, "pcg64_oneseq", boost::random::pcg64_oneseq());
+  run(iter, "pcg64_fast", boost::random::pcg64_fast());
+  run(iter, "sfc64", boost::random::sfc64());
+  run(iter, "wyrand", boost::random::wyrand());
+  run(iter, "romu_duo", boost::random::romu_duo());
+  run(iter, "romu_duo_jr", boost::random::romu_duo_jr());
+  run(iter, "romu_trio", boost::random::romu_trio());
 
 #ifdef HAVE_MT19937INT_C
   // requires the original mt19937int.c
@@ -0,0 +1,81 @@
+/* boost seed_seq_speed.cpp performance measurements
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ * Measures seed_seq::generate and hash_seed_seq::generate for the
+ * state sizes of common engines, and the cost of seeding those engines
+ * from each of them.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/random/hash_seed_seq.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/lagged_fibonacci.hpp>
+#include <boost/random/mixmax.hpp>
+
+template<class SeedSeq>
+void run_generate(int iter, std::size_t n, const std::string& name)
+{
+    SeedSeq seq = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u };
+    std::vector<boost::uint32_t> out(n);
+    boost::uint32_t sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iter; ++i) {
+        seq.generate(out.begin(), out.end());
+        sum += out[0];
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << "::generate(" << n << "): "
+              << elapsed.count() / iter << " us (" << sum % 2 << ")" << std::endl;
+}
+
+template<class Engine, class SeedSeq>
+void run_seed(int iter, const std::string& name, const std::string& seq_name)
+{
+    SeedSeq seq = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u };
+    Engine gen;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iter; ++i) {
+        gen.seed(seq);
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << name << ".seed(" << seq_name << "): "
+              << elapsed.count() / iter << " us" << std::endl;
+}
+
+template<class SeedSeq>
+void run_seeds(int iter, const std::string& seq_name)
+{
+    run_seed<boost::random::mt19937, SeedSeq>(iter, "mt19937", seq_name);
+    run_seed<boost::random::mt19937_64, SeedSeq>(iter, "mt19937_64", seq_name);
+    run_seed<boost::random::mixmax, SeedSeq>(iter, "mixmax", seq_name);
+    run_seed<boost::random::lagged_fibonacci44497, SeedSeq>(iter / 50 + 1, "lagged_fibonacci44497", seq_name);
+}
+
+int main(int argc, char** argv)
+{
+    int iter = 10000;
+    if(argc >= 2) {
+        iter = std::atoi(argv[1]);
+    }
+
+    const std::size_t sizes[] = { 8, 240, 624, 1248, 44497 };
+    for(std::size_t i = 0; i < sizeof(sizes)/sizeof(sizes[0]); ++i) {
+        int n = sizes[i] > 10000 ? iter / 50 + 1 : iter;
+        run_generate<boost::random::seed_seq>(n, sizes[i], "seed_seq");
+        run_generate<boost::random::hash_seed_seq>(n, sizes[i], "hash_seed_seq");
+    }
+    run_seeds<boost::random::seed_seq>(iter, "seed_seq");
+    run_seeds<boost::random::hash_seed_seq>(iter, "hash_seed_seq");
+}
@@ -21,7 +21,10 @@
 #include <boost/detail/workaround.hpp>
 #include <boost/system/system_error.hpp>
 #include <boost/system/error_code.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #if !defined(BOOST_NO_INCLASS_MEMBER_INITIALIZATION) && !BOOST_WORKAROUND(BOOST_MSVC, BOOST_TESTED_AT(1600))
 //  A definition is required even for integral static constants
@@ -82,10 +85,12 @@ const char * const default_token = "";
 #endif
 }
 
-class boost::random::random_device::impl
+namespace {
+
+class device
 {
 public:
-  impl(const std::string & token) : provider(token) {
+  device(const std::string & token) : provider(token) {
 #if !defined(BOOST_RANDOM_WINDOWS_RUNTIME)
     char buffer[80];
     DWORD type;
@@ -111,27 +116,30 @@ public:
   }
 
 #if !defined(BOOST_RANDOM_WINDOWS_RUNTIME)
-  ~impl() {
+  ~device() {
     if(!CryptReleaseContext(hProv, 0)) error("Could not release CSP context");
   }
 #endif
 
-  unsigned int next() {
-    unsigned int result;
-
+  void fill(unsigned int * out, std::size_t n) {
 #if !defined(BOOST_RANDOM_WINDOWS_RUNTIME)
-    if(!CryptGenRandom(hProv, sizeof(result),
-        static_cast<BYTE*>(static_cast<void*>(&result)))) {
-      error("error while reading");
+    BYTE * p = static_cast<BYTE*>(static_cast<void*>(out));
+    std::size_t size = n * sizeof(unsigned int);
+    while(size != 0) {
+      const DWORD chunk = static_cast<DWORD>((std::min)(size, std::size_t(0x10000000)));
+      if(!CryptGenRandom(hProv, chunk, p)) {
+        error("error while reading");
+      }
+      p += chunk;
+      size -= chunk;
     }
 #else
-    auto buffer = CryptographicBuffer::GenerateRandom(sizeof(result));
+    auto buffer = CryptographicBuffer::GenerateRandom(
+      static_cast<unsigned int>(n * sizeof(unsigned int)));
     auto data = ref new Array<unsigned char>(buffer->Length);
     CryptographicBuffer::CopyToByteArray(buffer, &data);
-    memcpy(&result, data->begin(), data->end() - data->begin());
+    memcpy(out, data->begin(), data->end() - data->begin());
 #endif
-
-    return result;
   }
 
 private:
@@ -149,6 +157,8 @@ private:
   const std::string provider;
 };
 
+}
+
 #else
 
 namespace {
@@ -185,32 +195,60 @@ extern int close(int __fd);
 #include <string.h>   // strerror
 #include <stdexcept>  // std::invalid_argument
 
+/*
+ * On Linux the default device is read with the getrandom() system call
+ * (Linux 3.17), which needs no file descriptor and returns up to 32 MiB
+ * per call.  It draws from the same pool as /dev/urandom, but blocks
+ * until that pool has been initialized.  Kernels without getrandom()
+ * fall back to opening /dev/urandom.
+ */
+#if defined(__linux__) && !defined(BOOST_RANDOM_NO_GETRANDOM)
+#include <sys/syscall.h>
+#if defined(SYS_getrandom)
+#define BOOST_RANDOM_HAS_GETRANDOM
+#endif
+#endif
+
+namespace {
 
-class boost::random::random_device::impl
+class device
 {
 public:
-  impl(const std::string & token) : path(token) {
+  device(const std::string & token) : path(token), fd(-1) {
+#if defined(BOOST_RANDOM_HAS_GETRANDOM)
+    // a zero length request tells whether the kernel has the call
+    if(token == default_token && syscall(SYS_getrandom, static_cast<void*>(0), 0, 0) == 0)
+      return;
+#endif
     fd = open(token.c_str(), O_RDONLY);
     if(fd < 0)
       error("cannot open");
   }
 
-  ~impl() { if(close(fd) < 0) error("could not close"); }
-
-  unsigned int next() {
-    unsigned int result;
-    std::size_t offset = 0;
-    do {
-      long sz = read(fd, reinterpret_cast<char *>(&result) + offset, sizeof(result) - offset);
-      if(sz == -1)
+  ~device() { if(fd >= 0 && close(fd) < 0) error("could not close"); }
+
+  void fill(unsigned int * out, std::size_t n) {
+    char * p = reinterpret_cast<char *>(out);
+    std::size_t size = n * sizeof(unsigned int);
+    while(size != 0) {
+      long sz;
+#if defined(BOOST_RANDOM_HAS_GETRANDOM)
+      if(fd < 0)
+        sz = syscall(SYS_getrandom, p, size, 0);
+      else
+#endif
+        sz = read(fd, p, size);
+      if(sz == -1) {
+        if(errno == EINTR)
+          continue;
         error("error while reading");
-      else if(sz == 0) {
+      } else if(sz == 0) {
         errno = 0;
         error("EOF while reading");
       }
-      offset += sz;
-    } while(offset < sizeof(result));
-    return result;
+      p += sz;
+      size -= sz;
+    }
   }
 
 private:
@@ -226,14 +264,65 @@ private:
   int fd;
 };
 
+}
+
 #endif // BOOST_WINDOWS
 
+// Adds the optional read-ahead buffer to the platform device.  Values
+// are handed out from the front of the buffer and it is refilled with
+// one request when empty.
+class boost::random::random_device::impl : public device
+{
+public:
+  impl(const std::string & token, std::size_t buffer_size)
+    : device(token), buffer(buffer_size), pos(buffer_size) {}
+
+  unsigned int next() {
+    if(buffer.empty()) {
+      unsigned int result;
+      device::fill(&result, 1);
+      return result;
+    }
+    if(pos == buffer.size()) {
+      device::fill(&buffer[0], buffer.size());
+      pos = 0;
+    }
+    return buffer[pos++];
+  }
+
+  void fill(unsigned int * out, std::size_t n) {
+    if(buffer.empty()) {
+      // nothing shared, so unbuffered devices may be used by several threads
+      device::fill(out, n);
+      return;
+    }
+    const std::size_t buffered = (std::min)(n, buffer.size() - pos);
+    std::copy(buffer.begin() + pos, buffer.begin() + pos + buffered, out);
+    pos += buffered;
+    if(n != buffered)
+      device::fill(out + buffered, n - buffered);
+  }
+
+private:
+  std::vector<unsigned int> buffer;
+  std::size_t pos;
+};
+
 BOOST_RANDOM_DECL boost::random::random_device::random_device()
-  : pimpl(new impl(default_token))
+  : pimpl(new impl(default_token, 0))
 {}
 
 BOOST_RANDOM_DECL boost::random::random_device::random_device(const std::string& token)
-  : pimpl(new impl(token))
+  : pimpl(new impl(token, 0))
+{}
+
+BOOST_RANDOM_DECL boost::random::random_device::random_device(std::size_t buffer_size)
+  : pimpl(new impl(default_token, buffer_size))
+{}
+
+BOOST_RANDOM_DECL boost::random::random_device::random_device(const std::string& token,
+                                                              std::size_t buffer_size)
+  : pimpl(new impl(token, buffer_size))
 {}
 
 BOOST_RANDOM_DECL boost::random_device::~random_device()
@@ -250,3 +339,8 @@ BOOST_RANDOM_DECL unsigned int boost::random_device::operator()()
 {
   return pimpl->next();
 }
+
+BOOST_RANDOM_DECL void boost::random_device::fill(unsigned int * first, std::size_t n)
+{
+  pimpl->fill(first, n);
+}
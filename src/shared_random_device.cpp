@@ -0,0 +1,154 @@
+/* boost shared_random_device.cpp implementation
+ *
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#ifndef BOOST_RANDOM_SOURCE
+#  define BOOST_RANDOM_SOURCE
+#endif
+
+#include <boost/random/shared_random_device.hpp>
+#include <boost/random/random_device.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/detail/workaround.hpp>
+#include <atomic>
+#include <cstddef>
+
+#if !defined(BOOST_NO_INCLASS_MEMBER_INITIALIZATION) && !BOOST_WORKAROUND(BOOST_MSVC, BOOST_TESTED_AT(1600))
+//  A definition is required even for integral static constants
+const bool boost::random::shared_random_device::has_fixed_range;
+#endif
+
+#if !defined(BOOST_WINDOWS)
+#include <pthread.h>  // pthread_atfork
+#endif
+
+namespace {
+
+// The buffer holds pool_size values.  The state packs a refill count
+// (the epoch) into the high half and the position of the next unused
+// value into the low half.  Taking n values is a compare-and-swap that
+// advances the position.  A refill first sets the position to busy
+// under a new epoch, then rewrites the values, then publishes position
+// 0.  A reader copies its values and checks that the epoch has not
+// changed meanwhile, as with a seqlock; if it has, the copy may be mixed
+// with values given to someone else, so it starts over.
+const std::size_t pool_size = 4096;
+const std::size_t max_claim = 256;
+const boost::uint32_t busy = 0xffffffffu;
+
+class pool
+{
+public:
+  pool() : state(pack(0, pool_size)) {
+#if !defined(BOOST_WINDOWS)
+    pthread_atfork(0, 0, &pool::after_fork);
+#endif
+  }
+
+  void fill(unsigned int * out, std::size_t n) {
+    if(n > max_claim) {
+      device.generate(out, out + n);
+      return;
+    }
+    boost::uint64_t s = state.load(std::memory_order_acquire);
+    for(;;) {
+      const boost::uint32_t epoch = static_cast<boost::uint32_t>(s >> 32);
+      const boost::uint32_t pos = static_cast<boost::uint32_t>(s);
+      if(pos != busy && pos + n <= pool_size) {
+        if(!state.compare_exchange_weak(s, s + n, std::memory_order_acquire,
+                                        std::memory_order_acquire))
+          continue;
+        for(std::size_t i = 0; i < n; ++i)
+          out[i] = words[pos + i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const boost::uint64_t now = state.load(std::memory_order_relaxed);
+        if(static_cast<boost::uint32_t>(now >> 32) == epoch)
+          return;
+        s = now;
+      } else if(pos == busy) {
+        // another thread is refilling
+        device.generate(out, out + n);
+        return;
+      } else {
+        const boost::uint32_t next = epoch + 1;
+        if(!state.compare_exchange_weak(s, pack(next, busy), std::memory_order_relaxed,
+                                        std::memory_order_acquire))
+          continue;
+        std::atomic_thread_fence(std::memory_order_release);
+        refill(next, out, n);
+        return;
+      }
+    }
+  }
+
+  static pool & instance() {
+    // never destroyed, so that it can be used during static destruction
+    static pool * p = new pool;
+    return *p;
+  }
+
+private:
+  static boost::uint64_t pack(boost::uint32_t epoch, boost::uint32_t pos)
+  { return (static_cast<boost::uint64_t>(epoch) << 32) | pos; }
+
+  // Only the thread that set the position to busy gets here, so it has
+  // staging to itself.  The first n values go to the caller.
+  void refill(boost::uint32_t epoch, unsigned int * out, std::size_t n) {
+    try {
+      device.generate(staging, staging + pool_size);
+    } catch(...) {
+      state.store(pack(epoch, pool_size), std::memory_order_relaxed);
+      throw;
+    }
+    for(std::size_t i = 0; i < pool_size; ++i)
+      words[i].store(staging[i], std::memory_order_relaxed);
+    for(std::size_t i = 0; i < n; ++i)
+      out[i] = staging[i];
+    state.store(pack(epoch, static_cast<boost::uint32_t>(n)), std::memory_order_release);
+  }
+
+#if !defined(BOOST_WINDOWS)
+  // The child has a copy of the buffer, which the parent will also hand
+  // out, so it must not use any of it.
+  static void after_fork() {
+    pool & p = instance();
+    const boost::uint64_t s = p.state.load(std::memory_order_relaxed);
+    p.state.store(pack(static_cast<boost::uint32_t>(s >> 32) + 1, pool_size),
+                  std::memory_order_relaxed);
+  }
+#endif
+
+  std::atomic<boost::uint64_t> state;
+  std::atomic<unsigned int> words[pool_size];
+  unsigned int staging[pool_size];
+  // without a buffer of its own, random_device may be used by several
+  // threads at once
+  boost::random::random_device device;
+};
+
+}
+
+BOOST_RANDOM_DECL double boost::random::shared_random_device::entropy() const
+{
+  return 10;
+}
+
+BOOST_RANDOM_DECL unsigned int boost::random::shared_random_device::operator()()
+{
+  unsigned int result;
+  pool::instance().fill(&result, 1);
+  return result;
+}
+
+BOOST_RANDOM_DECL void boost::random::shared_random_device::fill(unsigned int * first, std::size_t n)
+{
+  pool::instance().fill(first, n);
+}
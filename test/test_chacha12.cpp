@@ -0,0 +1,32 @@
+/* test_chacha12.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/chacha.hpp>
+#include <cstdint>
+
+#define BOOST_RANDOM_URNG boost::random::chacha12
+#define BOOST_RANDOM_CPP11_URNG
+#define BOOST_RANDOM_PROVIDED_SEED_TYPE std::uint64_t
+
+// values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT32_C(284109405)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT32_C(3046695278)
+
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_known_answer)
+{
+    // first keystream word for an all zero key and nonce
+    const boost::random::chacha12::key_type key = {{ 0, 0, 0, 0, 0, 0, 0, 0 }};
+    BOOST_CHECK_EQUAL(boost::random::chacha12::block(key, 0)[0], UINT32_C(0x6a9af49b));
+}
@@ -0,0 +1,120 @@
+/* test_chacha20.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/chacha.hpp>
+#include <cstdint>
+#include <vector>
+
+#define BOOST_RANDOM_URNG boost::random::chacha20
+#define BOOST_RANDOM_CPP11_URNG
+#define BOOST_RANDOM_PROVIDED_SEED_TYPE std::uint64_t
+
+// principal operation validated with RFC 7539, values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT32_C(547852541)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT32_C(3150288653)
+
+#define BOOST_RANDOM_DISCARD_COUNT2 20000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_known_answers)
+{
+    // RFC 7539 appendix A.1, test vectors 1 and 2 (all zero key and nonce),
+    // as little-endian words
+    using engine = boost::random::chacha20;
+    const engine::key_type key = {{ 0, 0, 0, 0, 0, 0, 0, 0 }};
+    const std::array<std::uint32_t, 16> block0 = {{
+        0xade0b876, 0x903df1a0, 0xe56a5d40, 0x28bd8653,
+        0xb819d2bd, 0x1aed8da0, 0xccef36a8, 0xc70d778b,
+        0x7c5941da, 0x8d485751, 0x3fe02477, 0x374ad8b8,
+        0xf4b8436a, 0x1ca11815, 0x69b687c3, 0x8665eeb2 }};
+    const std::array<std::uint32_t, 16> block1 = {{
+        0xbee7079f, 0x7a385155, 0x7c97ba98, 0x0d082d73,
+        0xa0290fcb, 0x6965e348, 0x3e53c612, 0xed7aee32,
+        0x7621b729, 0x434ee69c, 0xb03371d5, 0xd539d874,
+        0x281fed31, 0x45fb0a51, 0x1f0ae1ac, 0x6f4d794b }};
+    BOOST_CHECK(engine::block(key, 0) == block0);
+    BOOST_CHECK(engine::block(key, 1) == block1);
+
+    engine urng;
+    urng.set_key(key);
+    urng.set_counter(1);
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        BOOST_CHECK_EQUAL(urng(), block1[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_streams)
+{
+    using engine = boost::random::chacha20;
+    engine urng;
+    engine urng2;
+    urng2.set_stream(1);
+    BOOST_CHECK_NE(urng, urng2);
+    BOOST_CHECK_NE(urng(), urng2());
+
+    urng.set_stream(7);
+    urng.discard(16 * 1000 + 3);
+    urng2.set_stream(7);
+    urng2.set_counter(1000);
+    urng2.discard(3);
+    BOOST_CHECK_EQUAL(urng, urng2);
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate)
+{
+    // lengths straddling block and vector boundaries, into both a raw
+    // array and a container of a different integer type, with the low
+    // word of the counter wrapping in every other run
+    const std::size_t lengths[] = { 1, 15, 16, 17, 100, 256, 300, 5000 };
+    for (std::size_t k = 0; k < 2 * sizeof(lengths) / sizeof(lengths[0]); ++k)
+    {
+        boost::random::chacha20 urng;
+        if (k % 2 == 1)
+        {
+            urng.set_counter(UINT64_C(0xFFFFFFFF) - 5);
+        }
+        urng();
+        boost::random::chacha20 urng2(urng);
+        boost::random::chacha20 urng3(urng);
+        std::vector<std::uint32_t> contiguous(lengths[k / 2]);
+        std::vector<unsigned long long> converted(lengths[k / 2]);
+        urng2.generate(&contiguous[0], &contiguous[0] + contiguous.size());
+        urng3.generate(converted.begin(), converted.end());
+        for (std::size_t i = 0; i < lengths[k / 2]; ++i)
+        {
+            const std::uint32_t expected = urng();
+            BOOST_CHECK_EQUAL(contiguous[i], expected);
+            BOOST_CHECK_EQUAL(converted[i], expected);
+        }
+        BOOST_CHECK_EQUAL(urng, urng2);
+        BOOST_CHECK_EQUAL(urng, urng3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_wipe)
+{
+    boost::random::chacha20 urng(42);
+    urng.set_stream(7);
+    urng.set_counter(1000);
+    urng();
+    urng.wipe();
+
+    boost::random::chacha20 zero;
+    zero.set_key(boost::random::chacha20::key_type());
+    BOOST_CHECK_EQUAL(urng, zero);
+    for (int i = 0; i < 40; ++i)
+    {
+        BOOST_CHECK_EQUAL(urng(), zero());
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * This file compares against the reference RomuDuo, RomuDuoJr and
+ * RomuTrio from Mark A. Overton, "Romu: Fast Nonlinear Pseudo-Random
+ * Number Generators Providing High Quality" (2020).
+ */
+
+#include <boost/random/romu.hpp>
+#include <boost/random/splitmix64.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <vector>
+
+using std::uint64_t;
+
+#define ROTL(d,lrot) ((d<<(lrot)) | (d>>(8*sizeof(d)-(lrot))))
+
+static uint64_t xState, yState, zState;
+
+uint64_t romuDuo_random () {
+   uint64_t xp = xState;
+   xState = 15241094284759029579u * yState;
+   yState = ROTL(yState,36) + ROTL(yState,15) - xp;
+   return xp;
+}
+
+uint64_t romuDuoJr_random () {
+   uint64_t xp = xState;
+   xState = 15241094284759029579u * yState;
+   yState = yState - xp;  yState = ROTL(yState,27);
+   return xp;
+}
+
+uint64_t romuTrio_random () {
+   uint64_t xp = xState, yp = yState, zp = zState;
+   xState = 15241094284759029579u * zp;
+   yState = yp - xp;  yState = ROTL(yState,12);
+   zState = zp - yp;  zState = ROTL(zState,44);
+   return xp;
+}
+
+template <typename Engine, typename Reference>
+void test_engine(Reference ref)
+{
+    Engine boost_rng(42U);
+
+    boost::random::splitmix64 gen(42U);
+    xState = gen();
+    yState = gen();
+    zState = gen();
+
+    for (int i {}; i < 10000; ++i)
+    {
+        BOOST_TEST_EQ(boost_rng(), ref());
+    }
+
+    const auto final_state = boost_rng.state();
+    BOOST_TEST_EQ(final_state[0], xState);
+    BOOST_TEST_EQ(final_state[1], yState);
+    if (final_state.size() > 2)
+    {
+        BOOST_TEST_EQ(final_state.back(), zState);
+    }
+
+    boost::random::seed_seq seq {1, 2, 3};
+    Engine bulk_rng(seq);
+    Engine rng(bulk_rng);
+
+    std::vector<uint64_t> v(1001);
+    bulk_rng.generate(v.begin(), v.end());
+
+    for (const auto val : v)
+    {
+        BOOST_TEST_EQ(val, rng());
+    }
+    BOOST_TEST(bulk_rng == rng);
+
+    Engine skip_rng(seq);
+    skip_rng.discard(v.size());
+    BOOST_TEST(skip_rng == rng);
+}
+
+int main()
+{
+    test_engine<boost::random::romu_duo>(romuDuo_random);
+    test_engine<boost::random::romu_duo_jr>(romuDuoJr_random);
+    test_engine<boost::random::romu_trio>(romuTrio_random);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * This file compares against the reference sfc64 from PractRand by
+ * Chris Doty-Humphrey, which is in the public domain.
+ */
+
+#include <boost/random/sfc64.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <vector>
+
+using std::uint64_t;
+
+static uint64_t a, b, c, counter;
+
+static inline uint64_t rotl(const uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t raw64(void) {
+    uint64_t tmp = a + b + counter++;
+    a = b ^ (b >> 11);
+    b = c + (c << 3);
+    c = rotl(c, 24) + tmp;
+    return tmp;
+}
+
+void seed(uint64_t s) {
+    a = b = c = s;
+    counter = 1;
+    for (int i = 0; i < 12; i++) raw64();
+}
+
+void test_basic_seed()
+{
+    for (uint64_t value : { UINT64_C(0), UINT64_C(42), UINT64_C(0xDEADBEEFCAFEBABE) })
+    {
+        boost::random::sfc64 boost_rng(value);
+        seed(value);
+
+        for (int i {}; i < 10000; ++i)
+        {
+            BOOST_TEST_EQ(boost_rng(), raw64());
+        }
+
+        const auto final_state = boost_rng.state();
+        BOOST_TEST_EQ(final_state[0], a);
+        BOOST_TEST_EQ(final_state[1], b);
+        BOOST_TEST_EQ(final_state[2], c);
+        BOOST_TEST_EQ(final_state[3], counter);
+    }
+}
+
+void test_generate()
+{
+    boost::random::seed_seq seq {1, 2, 3};
+    boost::random::sfc64 bulk_rng(seq);
+    boost::random::sfc64 rng(bulk_rng);
+
+    std::vector<uint64_t> v(1001);
+    bulk_rng.generate(v.begin(), v.end());
+
+    for (const auto val : v)
+    {
+        BOOST_TEST_EQ(val, rng());
+    }
+    BOOST_TEST(bulk_rng == rng);
+
+    boost::random::sfc64 skip_rng(seq);
+    skip_rng.discard(v.size());
+    BOOST_TEST(skip_rng == rng);
+}
+
+// Replays the words that numpy.random.SeedSequence(12345).generate_state(6)
+// returns, so that the seeding can be compared with numpy's SFC64.
+struct numpy_seed_seq
+{
+    template <typename Iter>
+    void generate(Iter first, Iter last) const
+    {
+        static const std::uint32_t words[] = {
+            UINT32_C(2688385916), UINT32_C(3048105090), UINT32_C(4196366895),
+            UINT32_C(3152189807), UINT32_C(924159892), UINT32_C(1692637855)
+        };
+        for (std::size_t i = 0; first != last; ++first, ++i)
+        {
+            *first = words[i % 6];
+        }
+    }
+};
+
+void test_numpy_seed_seq()
+{
+    // numpy.random.SFC64(numpy.random.SeedSequence(12345)).random_raw(5)
+    const uint64_t expected[] = {
+        UINT64_C(3527068094297800258), UINT64_C(5648030432468382359),
+        UINT64_C(9063957079744815110), UINT64_C(10578705784777203114),
+        UINT64_C(17470318719332186685)
+    };
+
+    numpy_seed_seq seq;
+    boost::random::sfc64 rng(seq);
+    for (const auto val : expected)
+    {
+        BOOST_TEST_EQ(rng(), val);
+    }
+}
+
+int main()
+{
+    test_basic_seed();
+    test_generate();
+    test_numpy_seed_seq();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright Matt Borland 2025.
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * This file compares against the reference wyrand from wyhash final
+ * version 4 by Wang Yi, which is released into the public domain.
+ */
+
+#include <boost/random/wyrand.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <vector>
+
+using std::uint64_t;
+
+// The portable, non-intrinsic _wymum from wyhash.h
+static inline void _wymum(uint64_t *A, uint64_t *B){
+  uint64_t ha=*A>>32, hb=*B>>32, la=(uint32_t)*A, lb=(uint32_t)*B, hi, lo;
+  uint64_t rh=ha*hb, rm0=ha*lb, rm1=hb*la, rl=la*lb, t=rl+(rm0<<32), c=t<rl;
+  lo=t+(rm1<<32); c+=lo<t; hi=rh+(rm0>>32)+(rm1>>32)+c;
+  *A=lo;  *B=hi;
+}
+
+static inline uint64_t _wymix(uint64_t A, uint64_t B){ _wymum(&A,&B); return A^B; }
+
+static inline uint64_t wyrand(uint64_t *seed){ *seed+=0x2d358dccaa6c78a5ull; return _wymix(*seed,*seed^0x8bb84b93962eacc9ull);}
+
+void test_basic_seed()
+{
+    for (uint64_t value : { UINT64_C(0), UINT64_C(42), UINT64_C(0xDEADBEEFCAFEBABE) })
+    {
+        boost::random::wyrand boost_rng(value);
+        uint64_t s = value;
+
+        for (int i {}; i < 10000; ++i)
+        {
+            BOOST_TEST_EQ(boost_rng(), wyrand(&s));
+        }
+
+        BOOST_TEST_EQ(boost_rng.state(), s);
+    }
+}
+
+void test_discard()
+{
+    boost::random::wyrand rng(42U);
+    uint64_t s = 42U;
+    for (int i {}; i < 12345; ++i)
+    {
+        wyrand(&s);
+    }
+
+    rng.discard(12345U);
+    BOOST_TEST_EQ(rng.state(), s);
+    BOOST_TEST_EQ(rng(), wyrand(&s));
+}
+
+void test_generate()
+{
+    boost::random::seed_seq seq {1, 2, 3};
+    boost::random::wyrand bulk_rng(seq);
+    boost::random::wyrand rng(bulk_rng);
+
+    std::vector<uint64_t> v(1001);
+    bulk_rng.generate(v.begin(), v.end());
+
+    for (const auto val : v)
+    {
+        BOOST_TEST_EQ(val, rng());
+    }
+    BOOST_TEST(bulk_rng == rng);
+}
+
+int main()
+{
+    test_basic_seed();
+    test_discard();
+    test_generate();
+
+    return boost::report_errors();
+}
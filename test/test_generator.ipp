@@ -13,6 +13,7 @@
 #include <boost/random/seed_seq.hpp>
 #include <boost/random/detail/seed.hpp>
 #include <boost/random/detail/seed_impl.hpp>
+#include <vector>
 
 #define BOOST_TEST_MAIN
 #include <boost/test/unit_test.hpp>
@@ -193,6 +194,23 @@ BOOST_AUTO_TEST_CASE(test_discard2)
 }
 #endif
 
+#ifdef BOOST_RANDOM_GENERATE_BLOCKS
+BOOST_AUTO_TEST_CASE(test_generate_blocks)
+{
+    for(std::size_t n = 1; n < 200; n += 7) {
+        BOOST_RANDOM_URNG urng;
+        BOOST_RANDOM_URNG urng2;
+        urng.discard(n % 29);
+        urng2.discard(n % 29);
+        std::vector<boost::uint32_t> v(n), v2(n);
+        urng.generate(v.begin(), v.end());
+        boost::random::detail::generate(urng2, v2.begin(), v2.end());
+        BOOST_CHECK(v == v2);
+        BOOST_CHECK_EQUAL(urng, urng2);
+    }
+}
+#endif
+
 #ifdef BOOST_RANDOM_DISCARD_MAX
 BOOST_AUTO_TEST_CASE(test_discard_max)
 {
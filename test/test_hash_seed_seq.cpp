@@ -0,0 +1,122 @@
+/* test_hash_seed_seq.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/hash_seed_seq.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/lagged_fibonacci.hpp>
+#include <boost/random/ranlux.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/mixmax.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <bitset>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_interface)
+{
+    const boost::uint32_t data[4] = { 2, 3, 4, 0xdeadbeaf };
+    boost::random::hash_seed_seq seq(data, data + 4);
+    boost::random::hash_seed_seq il_seq = { 2u, 3u, 4u, 0xdeadbeafu };
+    BOOST_CHECK_EQUAL(seq.size(), 4u);
+    std::vector<boost::uint32_t> param;
+    seq.param(std::back_inserter(param));
+    BOOST_CHECK_EQUAL_COLLECTIONS(param.begin(), param.end(), data, data + 4);
+
+    // the same words give the same output, and shorter outputs are a
+    // prefix of longer ones
+    std::vector<boost::uint32_t> out(1001);
+    seq.generate(out.begin(), out.end());
+    for(std::size_t n = 0; n < 40; ++n) {
+        std::vector<boost::uint32_t> prefix(n);
+        il_seq.generate(prefix.begin(), prefix.end());
+        BOOST_CHECK(std::equal(prefix.begin(), prefix.end(), out.begin()));
+    }
+
+    // 64-bit destinations get the same 32-bit values
+    std::vector<boost::uint64_t> out64(1001);
+    seq.generate(out64.begin(), out64.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(out64.begin(), out64.end(), out.begin(), out.end());
+
+    std::sort(out.begin(), out.end());
+    BOOST_CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+
+    // the length is part of the input
+    boost::random::hash_seed_seq shorter(data, data + 3);
+    boost::random::hash_seed_seq zero = { 2u, 3u, 4u, 0xdeadbeafu, 0u };
+    boost::random::hash_seed_seq empty;
+    boost::uint32_t a[8], b[8], c[8], d[8];
+    seq.generate(a, a + 8);
+    shorter.generate(b, b + 8);
+    zero.generate(c, c + 8);
+    empty.generate(d, d + 8);
+    BOOST_CHECK(!std::equal(a, a + 8, b));
+    BOOST_CHECK(!std::equal(a, a + 8, c));
+    BOOST_CHECK(!std::equal(a, a + 8, d));
+}
+
+// Flipping any input bit changes about half of the bits of the output,
+// wherever they are.
+BOOST_AUTO_TEST_CASE(test_avalanche)
+{
+    const std::size_t n = 624;
+    boost::uint32_t data[3] = { 12345, 0, 42 };
+    boost::random::hash_seed_seq base(data, data + 3);
+    std::vector<boost::uint32_t> expected(n);
+    base.generate(expected.begin(), expected.end());
+    for(int word = 0; word < 3; ++word) {
+        for(int bit = 0; bit < 32; ++bit) {
+            data[word] ^= (1u << bit);
+            boost::random::hash_seed_seq seq(data, data + 3);
+            data[word] ^= (1u << bit);
+            std::vector<boost::uint32_t> out(n);
+            seq.generate(out.begin(), out.end());
+            std::size_t total = 0;
+            std::size_t last_word = 0;
+            for(std::size_t k = 0; k < n; ++k) {
+                std::size_t changed = std::bitset<32>(out[k] ^ expected[k]).count();
+                total += changed;
+                if(k == n - 1) last_word = changed;
+            }
+            // 624 * 16 bits on average, with a standard deviation of 70
+            BOOST_CHECK_GT(total, 624u * 16 - 500);
+            BOOST_CHECK_LT(total, 624u * 16 + 500);
+            BOOST_CHECK_GT(last_word, 0u);
+        }
+    }
+}
+
+template<class Engine>
+void check_engine()
+{
+    boost::random::hash_seed_seq seq = { 7u, 1u };
+    boost::random::hash_seed_seq other = { 7u, 2u };
+    Engine a(seq);
+    Engine b(seq);
+    Engine c(other);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != c);
+    c.seed(seq);
+    BOOST_CHECK(a == c);
+}
+
+BOOST_AUTO_TEST_CASE(test_engines)
+{
+    check_engine<boost::random::mt19937>();
+    check_engine<boost::random::mt19937_64>();
+    check_engine<boost::random::lagged_fibonacci607>();
+    check_engine<boost::random::ranlux24>();
+    check_engine<boost::random::ranlux64_3_01>();
+    check_engine<boost::random::minstd_rand>();
+    check_engine<boost::random::mixmax>();
+}
@@ -20,5 +20,8 @@
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE 618743552U
 
 #define BOOST_RANDOM_GENERATE_VALUES { 0x5642A47BU, 0x1F6987E8U, 0xD35860E7U, 0xC8C661ABU }
+#define BOOST_RANDOM_DISCARD_COUNT2 10000000
+#define BOOST_RANDOM_DISCARD_MAX
+#define BOOST_RANDOM_GENERATE_BLOCKS
 
 #include "test_generator.ipp"
@@ -9,6 +9,10 @@
  *
  */
 
+// Always use the polynomial jump in discard(), so that the block
+// boundary handling is covered by the short discards too.
+#define BOOST_RANDOM_LAGGED_FIBONACCI_DISCARD_THRESHOLD 0
+
 #include <boost/random/lagged_fibonacci.hpp>
 
 typedef boost::random::lagged_fibonacci_engine<boost::uint32_t, 24, 607, 273> lagged_fibonacci;
@@ -20,6 +24,9 @@ typedef boost::random::lagged_fibonacci_engine<boost::uint32_t, 24, 607, 273> la
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE 1364481U
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE 4372778U
 
+#define BOOST_RANDOM_DISCARD_COUNT2 10000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #define BOOST_RANDOM_GENERATE_VALUES { 0xF61A5094U, 0xFC4BA046U, 0xF1C41E92U, 0x3D82FE61U }
 
 #include "test_generator.ipp"
@@ -19,6 +19,9 @@
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE 0.73105942788451372
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE 0.72330291632639643
 
+#define BOOST_RANDOM_DISCARD_COUNT2 10000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #define BOOST_RANDOM_GENERATE_VALUES { 0x78EB0905U, 0x61766547U, 0xCB507F64U, 0x94FA3EC0U }
 
 #include "test_generator.ipp"
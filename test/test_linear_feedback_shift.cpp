@@ -9,6 +9,9 @@
  *
  */
 
+// force the jump-ahead path in discard()
+#define BOOST_RANDOM_LINEAR_FEEDBACK_SHIFT_DISCARD_THRESHOLD 0
+
 #include <boost/random/linear_feedback_shift.hpp>
 
 typedef boost::random::linear_feedback_shift_engine<boost::uint32_t, 32, 31, 13, 12> linear_feedback_shift;
@@ -21,5 +24,7 @@ typedef boost::random::linear_feedback_shift_engine<boost::uint32_t, 32, 31, 13,
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE 3112279337U
 
 #define BOOST_RANDOM_GENERATE_VALUES { 0x154005U, 0x54005502U, 0x5502BD4U, 0x2BD4005U }
+#define BOOST_RANDOM_DISCARD_COUNT2 10000000
+#define BOOST_RANDOM_DISCARD_MAX
 
 #include "test_generator.ipp"
@@ -11,6 +11,7 @@
 
 #include <boost/random/mixmax.hpp>
 #include <cmath>
+#include <sstream>
 
 #define BOOST_RANDOM_URNG boost::random::mixmax
 
@@ -24,6 +25,11 @@
 #define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(1842572666014501720)
 #define BOOST_RANDOM_GENERATE_VALUES {  3132207748, 2861541672, 3191701354, 4046050275 }
 
+// exercises the polynomial jump-ahead
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+#define BOOST_RANDOM_GENERATE_BLOCKS
+
 #include "test_generator.ipp"
 
 struct seed_seq_0 {
@@ -50,3 +56,93 @@ BOOST_AUTO_TEST_CASE(test_special_seed) {
         BOOST_CHECK_EQUAL(gen1, gen2);
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_discard_block_boundaries) {
+    // every position within a block, both sides of the jump-ahead threshold
+    for (std::uint64_t z = 0; z < 3 * 16 + 1; ++z) {
+        for (std::uint64_t extra = 0; extra <= 50000; extra += 50000 - 16) {
+            boost::random::mixmax gen1;
+            boost::random::mixmax gen2;
+            gen1();
+            gen2();
+            for (std::uint64_t j = 0; j < z + extra; ++j) gen1();
+            gen2.discard(z + extra);
+            BOOST_CHECK_EQUAL(gen1, gen2);
+            BOOST_CHECK_EQUAL(gen1(), gen2());
+        }
+    }
+}
+
+// The recurrence as the scalar code computes it, to check the vector
+// kernel and its fall back on states with small or non-canonical words.
+static std::uint64_t mixmax_ref_mod(std::uint64_t k)
+{
+    const std::uint64_t M61 = 2305843009213693951ULL;
+    return (k & M61) + (k >> 61);
+}
+
+static std::uint64_t mixmax_ref_iterate(std::uint64_t* Y, std::uint64_t sumtotOld)
+{
+    const std::uint64_t M61 = 2305843009213693951ULL;
+    std::uint64_t tempP = 0, tempV = sumtotOld;
+    Y[0] = tempV;
+    std::uint64_t sumtot = Y[0], ovflow = 0;
+    for (int i = 1; i < 17; i++) {
+        std::uint64_t tempPO = ((tempP << 36) & M61) ^ (tempP >> (61 - 36));
+        tempV = tempV + tempPO;
+        tempP = mixmax_ref_mod(tempP + Y[i]);
+        tempV = mixmax_ref_mod(tempV + tempP);
+        Y[i] = tempV;
+        sumtot += tempV; if (sumtot < tempV) { ovflow++; }
+    }
+    return mixmax_ref_mod(mixmax_ref_mod(sumtot) + (ovflow << 3));
+}
+
+static void check_against_reference(const std::uint64_t* init)
+{
+    std::uint64_t Y[17];
+    std::uint64_t sumtot = 0;
+    std::ostringstream os;
+    os << 17 << " " << 16 << " ";
+    for (int i = 0; i < 17; ++i) {
+        Y[i] = init[i];
+        sumtot = mixmax_ref_mod(sumtot + Y[i]);
+    }
+    os << sumtot;
+    for (int i = 0; i < 17; ++i) os << " " << Y[i];
+    std::istringstream is(os.str());
+    boost::random::mixmax gen;
+    is >> gen;
+    BOOST_REQUIRE(is);
+    BOOST_CHECK_EQUAL(gen(), Y[16]);
+    for (int block = 0; block < 8; ++block) {
+        sumtot = mixmax_ref_iterate(Y, sumtot);
+        for (int i = 1; i < 17; ++i) {
+            BOOST_CHECK_EQUAL(gen(), Y[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_iterate_reference) {
+    const std::uint64_t M61 = 2305843009213693951ULL;
+    std::uint64_t V[17] = {};
+    // nearly all zero: prefix sums of 0, 1 and 2
+    V[0] = 1;
+    check_against_reference(V);
+    V[0] = 0; V[3] = 2;
+    check_against_reference(V);
+    // a word and a running sum equal to M61
+    V[3] = 0; V[0] = M61;
+    check_against_reference(V);
+    V[0] = 5; V[7] = M61;
+    check_against_reference(V);
+    // prefix sums that wrap around to small values
+    for (int i = 0; i < 17; ++i) V[i] = (i % 2) ? M61 - 1 : 1;
+    check_against_reference(V);
+    // ordinary states
+    boost::random::mixmax gen(12345);
+    for (int k = 0; k < 100; ++k) {
+        for (int i = 0; i < 17; ++i) V[i] = gen();
+        check_against_reference(V);
+    }
+}
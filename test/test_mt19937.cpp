@@ -79,3 +79,44 @@ BOOST_AUTO_TEST_CASE(test_special_seed) {
     BOOST_CHECK_EQUAL(gen1, gen2);
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate) {
+    // lengths straddling block boundaries, into both a raw array
+    // and a container of a different integer type
+    const std::size_t lengths[] = { 1, 7, 623, 624, 625, 1300, 2000 };
+    for(std::size_t k = 0; k < sizeof(lengths)/sizeof(lengths[0]); ++k) {
+        boost::mt19937 urng;
+        urng();
+        boost::mt19937 urng2(urng);
+        boost::mt19937 urng3(urng);
+        std::vector<boost::uint32_t> contiguous(lengths[k]);
+        std::vector<unsigned long long> converted(lengths[k]);
+        urng2.generate(&contiguous[0], &contiguous[0] + contiguous.size());
+        urng3.generate(converted.begin(), converted.end());
+        for(std::size_t i = 0; i < lengths[k]; ++i) {
+            const boost::uint32_t expected = urng();
+            BOOST_CHECK_EQUAL(contiguous[i], expected);
+            BOOST_CHECK_EQUAL(converted[i], expected);
+        }
+        BOOST_CHECK_EQUAL(urng, urng2);
+        BOOST_CHECK_EQUAL(urng, urng3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_jump_plan) {
+    const boost::uintmax_t distances[] = { 0, 1, 623, 624, 100000, 20000000 };
+    for(std::size_t k = 0; k < sizeof(distances)/sizeof(distances[0]); ++k) {
+        boost::mt19937::jump_plan plan(distances[k]);
+        BOOST_CHECK_EQUAL(plan.distance(), distances[k]);
+        boost::mt19937 urng;
+        for(int j = 0; j < 3; ++j) {
+            boost::mt19937 expected(urng);
+            for(boost::uintmax_t z = 0; z < distances[k]; ++z) {
+                expected();
+            }
+            plan.apply(urng);
+            BOOST_CHECK_EQUAL(urng, expected);
+            urng();
+        }
+    }
+}
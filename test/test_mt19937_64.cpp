@@ -26,3 +26,26 @@
 #define BOOST_RANDOM_GENERATE_VALUES { 0xF6F6AEA6U, 0xC96D191CU, 0x8BC80F1CU, 0x401F7AC7U }
 
 #include "test_generator.ipp"
+
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate) {
+    // generate() writes each value as two 32-bit words, low word
+    // first; an odd length consumes the last value entirely.
+    const std::size_t lengths[] = { 1, 2, 7, 1247, 1248, 1249, 3001 };
+    for(std::size_t k = 0; k < sizeof(lengths)/sizeof(lengths[0]); ++k) {
+        boost::random::mt19937_64 urng;
+        urng();
+        boost::random::mt19937_64 urng2(urng);
+        std::vector<boost::uint32_t> actual(lengths[k]);
+        urng2.generate(actual.begin(), actual.end());
+        for(std::size_t i = 0; i < lengths[k]; i += 2) {
+            const boost::uint64_t expected = urng();
+            BOOST_CHECK_EQUAL(actual[i], static_cast<boost::uint32_t>(expected));
+            if(i + 1 < lengths[k]) {
+                BOOST_CHECK_EQUAL(actual[i + 1], static_cast<boost::uint32_t>(expected >> 32));
+            }
+        }
+        BOOST_CHECK_EQUAL(urng, urng2);
+    }
+}
@@ -0,0 +1,85 @@
+/* test_parallel_generate.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/parallel_generate.hpp>
+#include <boost/random/xoshiro.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/ranlux.hpp>
+#include <boost/random/inversive_congruential.hpp>
+#include <boost/random/philox.hpp>
+#include <boost/random/pcg.hpp>
+#include <boost/random/mixmax.hpp>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+// large enough to be split between threads
+const std::size_t size = 64 * 8 * BOOST_RANDOM_PARALLEL_GENERATE_BLOCK + 12345;
+
+template<class Engine, class T>
+void check_parallel_generate()
+{
+    Engine master;
+    master.discard(17);
+    std::vector<T> expected(size);
+    Engine serial(master);
+    serial.generate(expected.begin(), expected.end());
+    const std::size_t thread_counts[] = { 1, 2, 3, 8 };
+    for(std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i) {
+        std::vector<T> actual(size);
+        Engine eng(master);
+        boost::random::parallel_generate(eng, actual.begin(), actual.end(), thread_counts[i]);
+        BOOST_CHECK(actual == expected);
+        BOOST_CHECK(eng == serial);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_generate)
+{
+    check_parallel_generate<boost::random::xoshiro256pp, std::uint64_t>();
+    check_parallel_generate<boost::random::xoshiro256pp, std::uint32_t>();
+    check_parallel_generate<boost::random::mt19937, std::uint32_t>();
+    check_parallel_generate<boost::random::mt19937_64, std::uint32_t>();
+    check_parallel_generate<boost::random::ranlux24, std::uint32_t>();
+    check_parallel_generate<boost::random::ranlux64_4_01, std::uint32_t>();
+    check_parallel_generate<boost::random::philox4x32, std::uint32_t>();
+    check_parallel_generate<boost::random::pcg32, std::uint32_t>();
+    check_parallel_generate<boost::random::mixmax, std::uint32_t>();
+    // rejects values when packing, so it is filled serially
+    check_parallel_generate<boost::random::hellekalek1995, std::uint32_t>();
+}
+
+// A pcg32 whose discard() fails, as the allocating jump-ahead of some
+// engines may.
+struct throwing_pcg32 : boost::random::pcg32
+{
+    void discard(boost::uintmax_t z)
+    {
+        if(z != 0) throw std::bad_alloc();
+        boost::random::pcg32::discard(z);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_parallel_generate_throws)
+{
+    throwing_pcg32 master;
+    std::vector<std::uint32_t> values(size);
+    const std::size_t thread_counts[] = { 2, 3, 8 };
+    for(std::size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); ++i) {
+        throwing_pcg32 eng(master);
+        BOOST_CHECK_THROW(boost::random::parallel_generate(eng, values.begin(), values.end(), thread_counts[i]),
+                          std::bad_alloc);
+        BOOST_CHECK(eng == master);
+    }
+}
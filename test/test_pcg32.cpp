@@ -0,0 +1,56 @@
+/* test_pcg32.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/pcg.hpp>
+#include <boost/cstdint.hpp>
+
+#define BOOST_RANDOM_URNG boost::random::pcg32
+#define BOOST_RANDOM_PROVIDED_SEED_TYPE boost::uint64_t
+
+// principal operation validated with pcg-cpp, values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT32_C(156430672)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT32_C(1124130811)
+
+// exercises the logarithmic discard
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_known_answers)
+{
+    // pcg32-demo from the reference implementation, seed 42 and stream 54
+    const boost::uint32_t expected[] = {
+        0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e };
+    boost::random::pcg32 urng(42u, 54u);
+    for(std::size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        BOOST_CHECK_EQUAL(urng(), expected[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_streams)
+{
+    boost::random::pcg32 urng(42u, 54u);
+    boost::random::pcg32 urng2(42u, 55u);
+    BOOST_CHECK_EQUAL(urng.stream(), 54u);
+    BOOST_CHECK_NE(urng, urng2);
+    BOOST_CHECK_NE(urng(), urng2());
+
+    // set_stream keeps the state
+    boost::random::pcg32 urng3(urng);
+    urng3.set_stream(54u);
+    BOOST_CHECK_EQUAL(urng, urng3);
+
+    urng2.set_stream(54u);
+    urng2.seed(42u);
+    urng2.discard(1);
+    BOOST_CHECK_EQUAL(urng, urng2);
+}
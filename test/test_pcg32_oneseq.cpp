@@ -0,0 +1,26 @@
+/* test_pcg32_oneseq.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/pcg.hpp>
+#include <boost/cstdint.hpp>
+
+#define BOOST_RANDOM_URNG boost::random::pcg32_oneseq
+#define BOOST_RANDOM_PROVIDED_SEED_TYPE boost::uint64_t
+
+// values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT32_C(156430672)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT32_C(4157519267)
+
+// exercises the logarithmic discard
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
@@ -0,0 +1,103 @@
+/* test_philox4x32.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/philox.hpp>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+#define BOOST_RANDOM_URNG boost::random::philox4x32
+
+// validation value from C++26 [rand.predef], seed_seq value by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE 1955073260U
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE 3255709713U
+#define BOOST_RANDOM_DISCARD_COUNT2 20000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_known_answers) {
+    // philox4x32_10 known answer tests from Random123
+    typedef boost::random::philox4x32 engine;
+    {
+        const engine::key_type key = {{ 0, 0 }};
+        const engine::counter_type ctr = {{ 0, 0, 0, 0 }};
+        const engine::counter_type expected = {{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+    }
+    {
+        const engine::key_type key = {{ 0xa4093822, 0x299f31d0 }};
+        const engine::counter_type ctr = {{ 0x03707344, 0x13198a2e, 0x85a308d3, 0x243f6a88 }};
+        const engine::counter_type expected = {{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+
+        engine urng;
+        urng.set_key(key);
+        urng.set_counter(ctr);
+        for(std::size_t j = 0; j < 4; ++j) {
+            BOOST_CHECK_EQUAL(urng(), expected[j]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_counter) {
+    typedef boost::random::philox4x32 engine;
+    const engine::key_type key = {{ 12345, 67890 }};
+    engine urng;
+    urng.set_key(key);
+    urng.discard(4 * 1000 + 2);
+    engine urng2;
+    urng2.set_key(key);
+    const engine::counter_type ctr = {{ 0, 0, 0, 1000 }};
+    urng2.set_counter(ctr);
+    urng2.discard(2);
+    BOOST_CHECK_EQUAL(urng, urng2);
+
+    // the carry crosses from the least to the most significant word
+    const engine::counter_type last = {{ 0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF }};
+    const engine::counter_type next = {{ 1, 0, 0, 0 }};
+    urng.set_counter(last);
+    urng.discard(4);
+    urng2.set_counter(next);
+    BOOST_CHECK_EQUAL(urng, urng2);
+    const engine::counter_type expected = engine::block(key, next);
+    for(std::size_t j = 0; j < 4; ++j) {
+        BOOST_CHECK_EQUAL(urng(), expected[j]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate) {
+    // lengths straddling block and vector boundaries, into both a raw
+    // array and a container of a different integer type
+    const std::size_t lengths[] = { 1, 3, 4, 5, 31, 64, 67, 1000 };
+    for(std::size_t k = 0; k < 2 * sizeof(lengths)/sizeof(lengths[0]); ++k) {
+        boost::random::philox4x32 urng;
+        if(k % 2 == 1) {
+            // the low word of the counter wraps within the range
+            const boost::random::philox4x32::counter_type ctr =
+                {{ 0, 0, 1, (boost::random::philox4x32::max)() - 5 }};
+            urng.set_counter(ctr);
+        }
+        urng();
+        boost::random::philox4x32 urng2(urng);
+        boost::random::philox4x32 urng3(urng);
+        std::vector<boost::random::philox4x32::result_type> contiguous(lengths[k / 2]);
+        std::vector<boost::uint32_t> converted(lengths[k / 2]);
+        urng2.generate(&contiguous[0], &contiguous[0] + contiguous.size());
+        urng3.generate(converted.begin(), converted.end());
+        for(std::size_t i = 0; i < lengths[k / 2]; ++i) {
+            const boost::uint32_t expected = static_cast<boost::uint32_t>(urng());
+            BOOST_CHECK_EQUAL(contiguous[i], expected);
+            BOOST_CHECK_EQUAL(converted[i], expected);
+        }
+        BOOST_CHECK_EQUAL(urng, urng2);
+        BOOST_CHECK_EQUAL(urng, urng3);
+    }
+}
@@ -0,0 +1,109 @@
+/* test_philox4x64.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/philox.hpp>
+#include <vector>
+#include <boost/cstdint.hpp>
+
+#define BOOST_RANDOM_URNG boost::random::philox4x64
+
+// validation value from C++26 [rand.predef], seed_seq value by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(3409172418970261260)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(18017929890635768729)
+#define BOOST_RANDOM_DISCARD_COUNT2 20000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_known_answers) {
+    // philox4x64_10 known answer tests from Random123
+    typedef boost::random::philox4x64 engine;
+    {
+        const engine::key_type key = {{ 0, 0 }};
+        const engine::counter_type ctr = {{ 0, 0, 0, 0 }};
+        const engine::counter_type expected = {{
+            UINT64_C(0x16554d9eca36314c), UINT64_C(0xdb20fe9d672d0fdc),
+            UINT64_C(0xd7e772cee186176b), UINT64_C(0x7e68b68aec7ba23b) }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+    }
+    {
+        const engine::key_type key = {{ UINT64_C(0x452821e638d01377), UINT64_C(0xbe5466cf34e90c6c) }};
+        const engine::counter_type ctr = {{
+            UINT64_C(0x082efa98ec4e6c89), UINT64_C(0xa4093822299f31d0),
+            UINT64_C(0x13198a2e03707344), UINT64_C(0x243f6a8885a308d3) }};
+        const engine::counter_type expected = {{
+            UINT64_C(0xa528f45403e61d95), UINT64_C(0x38c72dbd566e9788),
+            UINT64_C(0xa5a1610e72fd18b5), UINT64_C(0x57bd43b5e52b7fe6) }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+
+        engine urng;
+        urng.set_key(key);
+        urng.set_counter(ctr);
+        for(std::size_t j = 0; j < 4; ++j) {
+            BOOST_CHECK_EQUAL(urng(), expected[j]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_counter) {
+    typedef boost::random::philox4x64 engine;
+    const engine::key_type key = {{ 12345, 67890 }};
+    engine urng;
+    urng.set_key(key);
+    urng.discard(4 * 1000 + 2);
+    engine urng2;
+    urng2.set_key(key);
+    const engine::counter_type ctr = {{ 0, 0, 0, 1000 }};
+    urng2.set_counter(ctr);
+    urng2.discard(2);
+    BOOST_CHECK_EQUAL(urng, urng2);
+
+    // the carry crosses from the least to the most significant word
+    const engine::counter_type last = {{ 0, ~UINT64_C(0), ~UINT64_C(0), ~UINT64_C(0) }};
+    const engine::counter_type next = {{ 1, 0, 0, 0 }};
+    urng.set_counter(last);
+    urng.discard(4);
+    urng2.set_counter(next);
+    BOOST_CHECK_EQUAL(urng, urng2);
+    const engine::counter_type expected = engine::block(key, next);
+    for(std::size_t j = 0; j < 4; ++j) {
+        BOOST_CHECK_EQUAL(urng(), expected[j]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate) {
+    // lengths straddling block and vector boundaries, into both a raw
+    // array and a container of a different integer type
+    const std::size_t lengths[] = { 1, 3, 4, 5, 31, 64, 67, 1000 };
+    for(std::size_t k = 0; k < 2 * sizeof(lengths)/sizeof(lengths[0]); ++k) {
+        boost::random::philox4x64 urng;
+        if(k % 2 == 1) {
+            // the low word of the counter wraps within the range
+            const boost::random::philox4x64::counter_type ctr =
+                {{ 0, 0, 1, (boost::random::philox4x64::max)() - 5 }};
+            urng.set_counter(ctr);
+        }
+        urng();
+        boost::random::philox4x64 urng2(urng);
+        boost::random::philox4x64 urng3(urng);
+        std::vector<boost::random::philox4x64::result_type> contiguous(lengths[k / 2]);
+        std::vector<boost::uint64_t> converted(lengths[k / 2]);
+        urng2.generate(&contiguous[0], &contiguous[0] + contiguous.size());
+        urng3.generate(converted.begin(), converted.end());
+        for(std::size_t i = 0; i < lengths[k / 2]; ++i) {
+            const boost::uint64_t expected = static_cast<boost::uint64_t>(urng());
+            BOOST_CHECK_EQUAL(contiguous[i], expected);
+            BOOST_CHECK_EQUAL(converted[i], expected);
+        }
+        BOOST_CHECK_EQUAL(urng, urng2);
+        BOOST_CHECK_EQUAL(urng, urng3);
+    }
+}
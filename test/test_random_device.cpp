@@ -9,6 +9,8 @@
  */
 
 #include <boost/random/random_device.hpp>
+#include <algorithm>
+#include <vector>
 
 #include <boost/test/test_tools.hpp>
 #include <boost/test/included/test_exec_monitor.hpp>
@@ -30,5 +32,22 @@ int test_main(int, char**) {
 
     boost::uint32_t a[10];
     rng.generate(a, a + 10);
+
+    // larger than one request through a non-pointer iterator
+    std::vector<boost::uint64_t> v(1000);
+    rng.generate(v.begin(), v.end());
+    BOOST_CHECK(std::count(v.begin(), v.end(), v[0]) < 10);
+
+    boost::random_device buffered(64);
+    for(int i = 0; i < 200; ++i) {
+        boost::random_device::result_type val = buffered();
+        BOOST_CHECK_GE(val, (buffered.min)());
+        BOOST_CHECK_LE(val, (buffered.max)());
+    }
+    // partly from the buffer, partly from the device
+    unsigned int b[100];
+    buffered.generate(b, b + 100);
+    BOOST_CHECK(std::count(b, b + 100, b[0]) < 10);
+    buffered.generate(b, b + 1);
     return 0;
 }
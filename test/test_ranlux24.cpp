@@ -21,6 +21,10 @@
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE 10086048U
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE 3888733U
 
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+#define BOOST_RANDOM_GENERATE_BLOCKS
+
 #define BOOST_RANDOM_GENERATE_VALUES { 0x55E57B2CU, 0xF2DEF915U, 0x6D1A0CD9U, 0xCA0109F9U }
 
 #include "test_generator.ipp"
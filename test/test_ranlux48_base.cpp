@@ -21,6 +21,9 @@
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(15556320400833)
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE UINT64_C(172853405006548)
 
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #define BOOST_RANDOM_GENERATE_VALUES { 0xFCE57B2CU, 0xF2DF1555U, 0x1A0C0CD9U, 0x490109FAU }
 
 #include "test_generator.ipp"
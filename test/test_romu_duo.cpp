@@ -0,0 +1,21 @@
+/* test_romu_duo.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/romu.hpp>
+#include <cstdint>
+
+#define BOOST_RANDOM_URNG boost::random::romu_duo
+
+// values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(1779785841864236470)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(15932357099690033941)
+
+#include "test_generator.ipp"
@@ -0,0 +1,221 @@
+/* test_secure_engine.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/secure_engine.hpp>
+#include <boost/random/chacha.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#if !defined(BOOST_WINDOWS)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+// A predictable entropy source that counts the requests made to it.
+struct counting_source
+{
+    static std::size_t calls;
+
+    template <typename Iter>
+    void generate(Iter first, Iter last)
+    {
+        ++calls;
+        for (std::uint32_t i = 0; first != last; ++first, ++i)
+        {
+            *first = static_cast<std::uint32_t>(calls * 1000 + i);
+        }
+    }
+};
+
+std::size_t counting_source::calls = 0;
+
+using test_engine = boost::random::basic_secure_engine<counting_source>;
+
+// An integer is not taken for a reseed limit, which would look like a seed.
+static_assert(!std::is_constructible<boost::random::secure_engine, int>::value, "");
+static_assert(!std::is_convertible<std::uint64_t, boost::random::reseed_limits>::value, "");
+
+// The keystream under key after the first eight words, which are the
+// next key, for a refill of sixteen blocks.
+std::vector<std::uint32_t> refill(boost::random::chacha20::key_type& key)
+{
+    boost::random::chacha20 cipher;
+    cipher.set_key(key);
+    std::vector<std::uint32_t> words(256);
+    cipher.generate(words.begin(), words.end());
+    std::copy(words.begin(), words.begin() + 8, key.begin());
+    return std::vector<std::uint32_t>(words.begin() + 8, words.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_fast_key_erasure)
+{
+    counting_source::calls = 0;
+    test_engine eng;
+    BOOST_CHECK_EQUAL(counting_source::calls, 1u);
+
+    boost::random::chacha20::key_type key;
+    counting_source::calls = 0;
+    counting_source().generate(key.begin(), key.end());
+    counting_source::calls = 1;
+
+    for (int r = 0; r < 3; ++r)
+    {
+        const std::vector<std::uint32_t> expected = refill(key);
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            BOOST_REQUIRE_EQUAL(eng(), expected[i]);
+        }
+    }
+    BOOST_CHECK_EQUAL(counting_source::calls, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate)
+{
+    counting_source::calls = 0;
+    test_engine eng;
+    boost::random::chacha20::key_type key;
+    counting_source::calls = 0;
+    counting_source().generate(key.begin(), key.end());
+
+    // three values through the buffer, then the rest of the buffer,
+    // whole blocks in place and the tail from a new buffer
+    std::vector<std::uint32_t> out(3 + 245 + 992 + 8);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        out[i] = eng();
+    }
+    eng.generate(out.data() + 3, out.data() + out.size());
+
+    std::vector<std::uint32_t> expected = refill(key);
+    boost::random::chacha20 cipher;
+    cipher.set_key(key);
+    std::vector<std::uint32_t> bulk(16 + 992);
+    cipher.generate(bulk.begin(), bulk.end());
+    std::copy(bulk.begin(), bulk.begin() + 8, key.begin());
+    expected.insert(expected.end(), bulk.begin() + 16, bulk.end());
+    const std::vector<std::uint32_t> tail = refill(key);
+    expected.insert(expected.end(), tail.begin(), tail.begin() + 8);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_reseed)
+{
+    counting_source::calls = 0;
+    test_engine eng(boost::random::reseed_limits(4096));
+    std::vector<std::uint32_t> out(10000);
+    eng.generate(out.begin(), out.end());
+    // 40000 bytes at most 4096 + 992 bytes apart
+    BOOST_CHECK_GE(counting_source::calls, 8u);
+    BOOST_CHECK_LE(counting_source::calls, 11u);
+
+    counting_source::calls = 0;
+    test_engine timed(boost::random::reseed_limits(boost::random::reseed_limits::default_bytes, std::chrono::seconds(0)));
+    for (int i = 0; i < 1000; ++i)
+    {
+        eng();
+        timed();
+    }
+    BOOST_CHECK_GE(counting_source::calls, 4u);
+
+    const std::size_t before = counting_source::calls;
+    timed.reseed_now();
+    BOOST_CHECK_EQUAL(counting_source::calls, before + 1);
+}
+
+// Whether the bytes of words appear anywhere in the storage.
+bool contains(const unsigned char* storage, std::size_t size, const std::uint32_t* words, std::size_t n)
+{
+    const unsigned char* first = reinterpret_cast<const unsigned char*>(words);
+    return std::search(storage, storage + size, first, first + n * sizeof(std::uint32_t)) != storage + size;
+}
+
+BOOST_AUTO_TEST_CASE(test_destructor_wipes)
+{
+    counting_source::calls = 0;
+    alignas(test_engine) unsigned char storage[sizeof(test_engine)];
+    test_engine* eng = new (storage) test_engine;
+
+    boost::random::chacha20::key_type key;
+    counting_source::calls = 0;
+    counting_source().generate(key.begin(), key.end());
+    const std::vector<std::uint32_t> expected = refill(key);
+    BOOST_CHECK_EQUAL((*eng)(), expected[0]);
+
+    // the next key and the values still buffered are in the engine
+    BOOST_REQUIRE(contains(storage, sizeof(storage), key.data(), key.size()));
+    BOOST_REQUIRE(contains(storage, sizeof(storage), &expected[1], 8));
+
+    eng->~test_engine();
+    BOOST_CHECK(!contains(storage, sizeof(storage), key.data(), key.size()));
+    BOOST_CHECK(!contains(storage, sizeof(storage), &expected[1], 8));
+}
+
+BOOST_AUTO_TEST_CASE(test_random_device_source)
+{
+    boost::random::secure_engine eng;
+    boost::random::uniform_int_distribution<int> dist(0, 9);
+    int counts[10] = {};
+    for (int i = 0; i < 10000; ++i)
+    {
+        ++counts[dist(eng)];
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        BOOST_CHECK_GT(counts[i], 800);
+    }
+
+    std::uint32_t a[1000];
+    std::uint32_t b[1000];
+    boost::random::secure_engine other;
+    eng.generate(a, a + 1000);
+    other.generate(b, b + 1000);
+    BOOST_CHECK(!std::equal(a, a + 1000, b));
+}
+
+#if !defined(BOOST_WINDOWS)
+
+BOOST_AUTO_TEST_CASE(test_fork)
+{
+    boost::random::secure_engine eng;
+    // make sure the buffer holds unused values
+    eng();
+    int fds[2];
+    BOOST_REQUIRE_EQUAL(pipe(fds), 0);
+    const pid_t pid = fork();
+    BOOST_REQUIRE(pid >= 0);
+    std::uint32_t values[4];
+    eng.generate(values, values + 4);
+    if (pid == 0)
+    {
+        const ssize_t written = write(fds[1], values, sizeof(values));
+        _exit(written == static_cast<ssize_t>(sizeof(values)) ? 0 : 1);
+    }
+    std::uint32_t child[4];
+    const ssize_t got = read(fds[0], child, sizeof(child));
+    int status = 0;
+    waitpid(pid, &status, 0);
+    close(fds[0]);
+    close(fds[1]);
+    BOOST_REQUIRE_EQUAL(got, static_cast<ssize_t>(sizeof(child)));
+    BOOST_CHECK(!std::equal(values, values + 4, child));
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <boost/random/seed_seq.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/config.hpp>
+#include <algorithm>
 #include <vector>
 
 #define BOOST_TEST_MAIN
@@ -128,3 +129,57 @@ BOOST_AUTO_TEST_CASE(test_seed_seq_short_output) {
     BOOST_CHECK_EQUAL_COLLECTIONS(
         &store32[0], &store32[0] + 2, &expected_short[0], &expected_short[0] + 2);
 }
+
+// The algorithm as written in the standard, with the indices
+// reduced modulo n at every step.
+void reference_generate(const std::vector<boost::uint32_t>& v,
+                        boost::uint32_t* first, std::size_t n)
+{
+    std::fill(first, first + n, 0x8b8b8b8bu);
+    std::size_t s = v.size();
+    std::size_t t = (n >= 623) ? 11 : (n >= 68) ? 7 : (n >= 39) ? 5 : (n >= 7) ? 3 : (n - 1)/2;
+    std::size_t p = (n - t) / 2;
+    std::size_t q = p + t;
+    std::size_t m = (std::max)(s+1, n);
+    for(std::size_t k = 0; k < m; ++k) {
+        boost::uint32_t r1 = first[k%n] ^ first[(k+p)%n] ^ first[(k+n-1)%n];
+        r1 = (r1 ^ (r1 >> 27)) * 1664525u;
+        boost::uint32_t r2 = static_cast<boost::uint32_t>(r1 +
+            ((k == 0) ? s : (k <= s) ? k % n + v[k - 1] : k % n));
+        first[(k+p)%n] += r1;
+        first[(k+q)%n] += r2;
+        first[k%n] = r2;
+    }
+    for(std::size_t k = m; k < m + n; ++k) {
+        boost::uint32_t r3 = first[k%n] + first[(k+p)%n] + first[(k+n-1)%n];
+        r3 = (r3 ^ (r3 >> 27)) * 1566083941u;
+        boost::uint32_t r4 = static_cast<boost::uint32_t>(r3 - k%n);
+        first[(k+p)%n] ^= r3;
+        first[(k+q)%n] ^= r4;
+        first[k%n] = r4;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_seed_seq_sizes) {
+    std::vector<boost::uint32_t> data;
+    boost::uint32_t x = 1;
+    for(std::size_t s = 0; s < 700; s += (s < 16 ? 1 : 97)) {
+        while(data.size() < s) {
+            x = x * 69069u + 1u;
+            data.push_back(x);
+        }
+        boost::random::seed_seq seq(data.begin(), data.end());
+        for(std::size_t n = 1; n < 1300; n += (n < 80 ? 1 : 61)) {
+            std::vector<boost::uint32_t> expected(n);
+            std::vector<boost::uint32_t> actual(n);
+            std::vector<boost::uint32_t> actual_ptr(n);
+            reference_generate(data, &expected[0], n);
+            seq.generate(actual.begin(), actual.end());
+            seq.generate(&actual_ptr[0], &actual_ptr[0] + n);
+            BOOST_REQUIRE_EQUAL_COLLECTIONS(
+                actual.begin(), actual.end(), expected.begin(), expected.end());
+            BOOST_REQUIRE_EQUAL_COLLECTIONS(
+                actual_ptr.begin(), actual_ptr.end(), expected.begin(), expected.end());
+        }
+    }
+}
@@ -0,0 +1,21 @@
+/* test_sfc64.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/sfc64.hpp>
+#include <cstdint>
+
+#define BOOST_RANDOM_URNG boost::random::sfc64
+
+// values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(7636615790858405292)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(11953854381969882034)
+
+#include "test_generator.ipp"
@@ -0,0 +1,109 @@
+/* test_shared_random_device.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/shared_random_device.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if !defined(BOOST_WINDOWS)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_interface)
+{
+    boost::random::shared_random_device rd;
+    BOOST_CHECK_GE(rd.entropy(), 0);
+    for(int i = 0; i < 100; ++i) {
+        boost::random::shared_random_device::result_type val = rd();
+        BOOST_CHECK_GE(val, (rd.min)());
+        BOOST_CHECK_LE(val, (rd.max)());
+    }
+    std::vector<boost::uint64_t> v(1000);
+    rd.generate(v.begin(), v.end());
+    BOOST_CHECK(std::count(v.begin(), v.end(), v[0]) < 10);
+
+    // copies share the process-wide buffer
+    boost::random::shared_random_device copy(rd);
+    boost::random::mt19937 gen(copy);
+    (void)gen();
+}
+
+// Every value is handed out once, so 64-bit values made of consecutive
+// pairs never repeat, across threads and refills.
+BOOST_AUTO_TEST_CASE(test_concurrent_unique)
+{
+    const std::size_t threads = 8;
+    const std::size_t count = 20000;
+    std::vector<std::vector<boost::uint64_t> > results(threads);
+    std::vector<std::thread> workers;
+    for(std::size_t t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([t, &results]() {
+            boost::random::shared_random_device rd;
+            results[t].reserve(count);
+            for(std::size_t i = 0; i < count; ++i) {
+                unsigned int pair[2];
+                if(i % 2 == 0) {
+                    rd.generate(pair, pair + 2);
+                } else {
+                    pair[0] = rd();
+                    pair[1] = rd();
+                }
+                results[t].push_back((static_cast<boost::uint64_t>(pair[0]) << 32) | pair[1]);
+            }
+        }));
+    }
+    for(std::size_t t = 0; t < threads; ++t) {
+        workers[t].join();
+    }
+    std::vector<boost::uint64_t> all;
+    for(std::size_t t = 0; t < threads; ++t) {
+        all.insert(all.end(), results[t].begin(), results[t].end());
+    }
+    std::sort(all.begin(), all.end());
+    BOOST_CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+#if !defined(BOOST_WINDOWS)
+
+BOOST_AUTO_TEST_CASE(test_fork)
+{
+    boost::random::shared_random_device rd;
+    // make sure the buffer holds unused values
+    (void)rd();
+    int fds[2];
+    BOOST_REQUIRE_EQUAL(pipe(fds), 0);
+    const pid_t pid = fork();
+    BOOST_REQUIRE(pid >= 0);
+    unsigned int values[4];
+    rd.generate(values, values + 4);
+    if(pid == 0) {
+        const ssize_t written = write(fds[1], values, sizeof(values));
+        _exit(written == static_cast<ssize_t>(sizeof(values)) ? 0 : 1);
+    }
+    unsigned int child[4];
+    const ssize_t got = read(fds[0], child, sizeof(child));
+    int status = 0;
+    waitpid(pid, &status, 0);
+    close(fds[0]);
+    close(fds[1]);
+    BOOST_REQUIRE_EQUAL(got, static_cast<ssize_t>(sizeof(child)));
+    BOOST_CHECK(!std::equal(values, values + 4, child));
+}
+
+#endif
@@ -0,0 +1,139 @@
+/* test_split_streams.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/split_streams.hpp>
+#include <boost/random/xoshiro.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/additive_combine.hpp>
+#include <boost/random/pcg.hpp>
+#include <boost/random/philox.hpp>
+#include <boost/random/ranlux.hpp>
+#include <boost/random/mixmax.hpp>
+#include <boost/random/wyrand.hpp>
+#include <boost/random/sfc64.hpp>
+#include <boost/random/romu.hpp>
+#include <boost/random/shuffle_order.hpp>
+#include <boost/random/independent_bits.hpp>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+template<class Engine>
+void check_layout(const boost::random::engine_streams<Engine>& streams)
+{
+    for(std::size_t k = 0; k < streams.size(); ++k) {
+        const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(&streams[k]);
+        BOOST_CHECK_EQUAL(addr % BOOST_RANDOM_CACHE_LINE_SIZE, 0u);
+        if(k > 0) {
+            BOOST_CHECK(streams[k] != streams[k - 1]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_xoshiro_jump)
+{
+    boost::random::xoshiro256pp master(42);
+    boost::random::engine_streams<boost::random::xoshiro256pp> streams =
+        boost::random::split_streams(master, 5);
+    BOOST_CHECK_EQUAL(streams.size(), 5u);
+    check_layout(streams);
+    boost::random::xoshiro256pp expected(master);
+    for(std::size_t k = 0; k < streams.size(); ++k) {
+        BOOST_CHECK(streams[k] == expected);
+        expected.jump();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_mt_jump_plan)
+{
+    boost::random::mt19937 master(42);
+    boost::random::engine_streams<boost::random::mt19937> streams =
+        boost::random::split_streams(master, 3);
+    check_layout(streams);
+    boost::random::mt19937 expected(master);
+    for(std::size_t k = 0; k < streams.size(); ++k) {
+        BOOST_CHECK_EQUAL(streams[k], expected);
+        expected.discard((std::numeric_limits<boost::uintmax_t>::max)());
+    }
+}
+
+template<class Engine>
+void check_discard_split(std::size_t n, boost::uintmax_t stride)
+{
+    Engine master;
+    master.discard(12345);
+    boost::random::engine_streams<Engine> streams = boost::random::split_streams(master, n);
+    BOOST_CHECK_EQUAL(streams.size(), n);
+    check_layout(streams);
+    Engine expected(master);
+    for(std::size_t k = 0; k < streams.size(); ++k) {
+        BOOST_CHECK_EQUAL(streams[k], expected);
+        expected.discard(stride);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_discard_split)
+{
+    // short periods are divided evenly
+    check_discard_split<boost::random::minstd_rand>(7, 2147483646u / 7);
+    check_discard_split<boost::random::rand48>(16, (UINT64_C(1) << 48) / 16);
+    check_discard_split<boost::random::ecuyer1988>(3,
+        UINT64_C(2147483562) * UINT64_C(2147483398) / 2 / 3);
+    // long periods use 2^64-1 values in total
+    const boost::uintmax_t max = (std::numeric_limits<boost::uintmax_t>::max)();
+    check_discard_split<boost::random::pcg32>(4, max / 4);
+    check_discard_split<boost::random::philox4x32>(9, max / 9);
+}
+
+BOOST_AUTO_TEST_CASE(test_edge_cases)
+{
+    boost::random::engine_streams<boost::random::minstd_rand> none =
+        boost::random::split_streams(boost::random::minstd_rand(), 0);
+    BOOST_CHECK_EQUAL(none.size(), 0u);
+
+    boost::random::engine_streams<boost::random::minstd_rand> one =
+        boost::random::split_streams(boost::random::minstd_rand(), 1);
+    BOOST_CHECK_EQUAL(one.size(), 1u);
+    BOOST_CHECK_EQUAL(one[0], boost::random::minstd_rand());
+
+    boost::random::engine_streams<boost::random::minstd_rand> moved(std::move(one));
+    BOOST_CHECK_EQUAL(moved.size(), 1u);
+    BOOST_CHECK_EQUAL(one.size(), 0u);
+
+    typedef boost::random::linear_congruential_engine<boost::uint32_t, 3, 0, 7> tiny;
+    BOOST_CHECK_THROW(boost::random::split_streams(tiny(), 7), std::invalid_argument);
+}
+
+// Engines that can only step are rejected rather than stepped 2^64/n times.
+static_assert(boost::random::detail::is_splittable<boost::random::ranlux24>::value, "ranlux24");
+static_assert(boost::random::detail::is_splittable<boost::random::ranlux64_3_01>::value, "ranlux64_3_01");
+static_assert(boost::random::detail::is_splittable<boost::random::mixmax>::value, "mixmax");
+static_assert(boost::random::detail::is_splittable<boost::random::wyrand>::value, "wyrand");
+static_assert(boost::random::detail::is_splittable<boost::random::ecuyer1988>::value, "ecuyer1988");
+static_assert(!boost::random::detail::is_splittable<boost::random::sfc64>::value, "sfc64");
+static_assert(!boost::random::detail::is_splittable<boost::random::romu_duo>::value, "romu_duo");
+static_assert(!boost::random::detail::is_splittable<boost::random::romu_trio>::value, "romu_trio");
+static_assert(!boost::random::detail::is_splittable<boost::random::knuth_b>::value, "knuth_b");
+static_assert(!boost::random::detail::is_splittable<
+    boost::random::independent_bits_engine<boost::random::minstd_rand, 64, boost::uint64_t> >::value,
+    "independent_bits_engine");
+
+BOOST_AUTO_TEST_CASE(test_logarithmic_discard_split)
+{
+    const boost::uintmax_t max = (std::numeric_limits<boost::uintmax_t>::max)();
+    check_discard_split<boost::random::ranlux24>(3, max / 3);
+    check_discard_split<boost::random::mixmax>(2, max / 2);
+    check_discard_split<boost::random::wyrand>(5, max / 5);
+}
@@ -0,0 +1,108 @@
+/* test_static_seed_seq.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/static_seed_seq.hpp>
+#include <boost/random/seed_seq.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/lagged_fibonacci.hpp>
+#include <boost/random/ranlux.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/xoshiro.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+// Counts the allocations made through the global operator new.
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t n)
+{
+    ++allocations;
+    if(void* p = std::malloc(n ? n : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+BOOST_AUTO_TEST_CASE(test_matches_seed_seq)
+{
+    const boost::uint32_t data[5] = { 2, 3, 4, 0xdeadbeaf, 7 };
+    for(std::size_t k = 0; k <= 5; ++k) {
+        boost::random::seed_seq expected_seq(data, data + k);
+        boost::random::static_seed_seq<8> seq(data, data + k);
+        BOOST_CHECK_EQUAL(seq.size(), k);
+        for(std::size_t n = 0; n < 700; n += 37) {
+            std::vector<boost::uint32_t> expected(n), actual(n);
+            expected_seq.generate(expected.begin(), expected.end());
+            seq.generate(actual.begin(), actual.end());
+            BOOST_CHECK(expected == actual);
+        }
+        std::vector<boost::uint32_t> param;
+        seq.param(std::back_inserter(param));
+        BOOST_CHECK_EQUAL_COLLECTIONS(param.begin(), param.end(), data, data + k);
+    }
+
+    boost::random::static_seed_seq<4> seq(2, 3, 4, 0xdeadbeafu);
+    boost::random::seed_seq expected_seq(data, data + 4);
+    boost::uint32_t expected[10];
+    boost::uint32_t actual[10];
+    expected_seq.generate(expected, expected + 10);
+    seq.generate(actual, actual + 10);
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual, actual + 10, expected, expected + 10);
+
+    BOOST_CHECK_THROW(boost::random::static_seed_seq<4>(data, data + 5), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_constexpr)
+{
+    constexpr boost::random::static_seed_seq<4> seq(1, 2u, 3ul);
+    static_assert(seq.size() == 3, "constexpr size");
+    static_assert(boost::random::static_seed_seq<4>::capacity() == 4, "constexpr capacity");
+    constexpr boost::random::static_seed_seq<2> empty;
+    static_assert(empty.size() == 0, "constexpr empty size");
+
+    const boost::uint32_t data[3] = { 1, 2, 3 };
+    boost::random::seed_seq expected_seq(data, data + 3);
+    boost::random::mt19937 expected(expected_seq);
+    boost::random::mt19937 actual(seq);
+    BOOST_CHECK(expected == actual);
+}
+
+template<class Engine>
+void check_no_allocation()
+{
+    const std::size_t before = allocations;
+    boost::random::static_seed_seq<4> seq(1, 2, 3, 4);
+    Engine engine(seq);
+    engine.seed(seq);
+    (void)engine();
+    BOOST_CHECK_EQUAL(allocations, before);
+}
+
+BOOST_AUTO_TEST_CASE(test_engines_do_not_allocate)
+{
+    check_no_allocation<boost::random::mt19937>();
+    check_no_allocation<boost::random::mt19937_64>();
+    check_no_allocation<boost::random::lagged_fibonacci607>();
+    check_no_allocation<boost::random::ranlux24>();
+    check_no_allocation<boost::random::ranlux64_3_01>();
+    check_no_allocation<boost::random::minstd_rand>();
+    check_no_allocation<boost::random::xoshiro256pp>();
+}
@@ -20,5 +20,7 @@
 #define BOOST_RANDOM_ITERATOR_VALIDATION_VALUE 3762466828U
 
 #define BOOST_RANDOM_GENERATE_VALUES { 0x2B55504U, 0x5403F102U, 0xED45297EU, 0x6B84007U }
+#define BOOST_RANDOM_DISCARD_COUNT2 10000000
+#define BOOST_RANDOM_DISCARD_MAX
 
 #include "test_generator.ipp"
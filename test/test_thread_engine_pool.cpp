@@ -0,0 +1,95 @@
+/* test_thread_engine_pool.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/thread_engine_pool.hpp>
+#include <boost/random/xoshiro.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/ranlux.hpp>
+#include <boost/random/mixmax.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+template<class Engine>
+void check_matches_split(std::size_t capacity)
+{
+    boost::random::thread_engine_pool<Engine> pool(UINT64_C(0x0123456789ABCDEF), capacity);
+    boost::random::engine_streams<Engine> streams =
+        boost::random::split_streams(pool.master(), capacity);
+    // out of order, as threads would ask
+    for(std::size_t i = capacity; i-- > 0; ) {
+        Engine& e = pool.get(i);
+        BOOST_CHECK(e == streams[i]);
+        BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(&e) % BOOST_RANDOM_CACHE_LINE_SIZE, 0u);
+        BOOST_CHECK_EQUAL(&e, &pool.get(i));
+    }
+    // in order, and with an index below the cursor
+    boost::random::thread_engine_pool<Engine> ordered(pool.master(), capacity);
+    for(std::size_t i = 0; i < capacity; i += 2) {
+        BOOST_CHECK(ordered.get(i) == streams[i]);
+    }
+    BOOST_CHECK(ordered.get(1) == streams[1]);
+    BOOST_CHECK(ordered.get(capacity - 1) == streams[capacity - 1]);
+}
+
+BOOST_AUTO_TEST_CASE(test_deterministic_streams)
+{
+    check_matches_split<boost::random::xoshiro256pp>(6);
+    check_matches_split<boost::random::mt19937>(3);
+    check_matches_split<boost::random::minstd_rand>(9);
+    check_matches_split<boost::random::ranlux24>(4);
+    check_matches_split<boost::random::mixmax>(4);
+}
+
+BOOST_AUTO_TEST_CASE(test_master_seed)
+{
+    boost::random::thread_engine_pool<boost::random::xoshiro256pp> pool1(42, 2);
+    boost::random::thread_engine_pool<boost::random::xoshiro256pp> pool2(42, 2);
+    boost::random::thread_engine_pool<boost::random::xoshiro256pp> pool3(43, 2);
+    BOOST_CHECK(pool1.get(1) == pool2.get(1));
+    BOOST_CHECK(pool1.get(1) != pool3.get(1));
+    BOOST_CHECK_THROW(pool1.get(2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent_get)
+{
+    typedef boost::random::xoshiro256pp engine_type;
+    const std::size_t n = 8;
+    boost::random::thread_engine_pool<engine_type> pool(7, n);
+    std::vector<std::uint64_t> results(n);
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < n; ++t) {
+        threads.push_back(std::thread([&pool, &results, t]() {
+            engine_type& gen = pool.get(t);
+            std::uint64_t sum = 0;
+            for(int i = 0; i < 1000; ++i) {
+                sum += gen();
+            }
+            results[t] = sum;
+        }));
+    }
+    for(std::size_t t = 0; t < n; ++t) {
+        threads[t].join();
+    }
+
+    boost::random::engine_streams<engine_type> streams = boost::random::split_streams(pool.master(), n);
+    for(std::size_t t = 0; t < n; ++t) {
+        std::uint64_t sum = 0;
+        for(int i = 0; i < 1000; ++i) {
+            sum += streams[t]();
+        }
+        BOOST_CHECK_EQUAL(results[t], sum);
+    }
+}
@@ -0,0 +1,120 @@
+/* test_threefry4x64.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/threefry.hpp>
+#include <cstdint>
+#include <vector>
+
+#define BOOST_RANDOM_URNG boost::random::threefry4x64
+#define BOOST_RANDOM_CPP11_URNG
+
+// principal operation validated with Random123, values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(8684772883849008251)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(4826418307530813203)
+
+#define BOOST_RANDOM_DISCARD_COUNT2 20000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_known_answers)
+{
+    // threefry4x64_20 known answer tests from Random123, with the
+    // counter reversed to put the most significant word first
+    using engine = boost::random::threefry4x64;
+    {
+        const engine::key_type key = {{ 0, 0, 0, 0 }};
+        const engine::counter_type ctr = {{ 0, 0, 0, 0 }};
+        const std::array<std::uint64_t, 4> expected = {{
+            UINT64_C(0x09218ebde6c85537), UINT64_C(0x55941f5266d86105),
+            UINT64_C(0x4bd25e16282434dc), UINT64_C(0xee29ec846bd2e40b) }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+    }
+    {
+        const std::uint64_t ones = ~UINT64_C(0);
+        const engine::key_type key = {{ ones, ones, ones, ones }};
+        const engine::counter_type ctr = {{ ones, ones, ones, ones }};
+        const std::array<std::uint64_t, 4> expected = {{
+            UINT64_C(0x29c24097942bba1b), UINT64_C(0x0371bbfb0f6f4e11),
+            UINT64_C(0x3c231ffa33f83a1c), UINT64_C(0xcd29113fde32d168) }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+    }
+    {
+        const engine::key_type key = {{
+            UINT64_C(0x452821e638d01377), UINT64_C(0xbe5466cf34e90c6c),
+            UINT64_C(0xbe5466cf34e90c6c), UINT64_C(0xc0ac29b7c97c50dd) }};
+        const engine::counter_type ctr = {{
+            UINT64_C(0x082efa98ec4e6c89), UINT64_C(0xa4093822299f31d0),
+            UINT64_C(0x13198a2e03707344), UINT64_C(0x243f6a8885a308d3) }};
+        const std::array<std::uint64_t, 4> expected = {{
+            UINT64_C(0xa7e8fde591651bd9), UINT64_C(0xbaafd0c30138319b),
+            UINT64_C(0x84a5c1a729e685b9), UINT64_C(0x901d406ccebc1ba4) }};
+        BOOST_CHECK(engine::block(key, ctr) == expected);
+
+        engine urng;
+        urng.set_key(key);
+        urng.set_counter(ctr);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            BOOST_CHECK_EQUAL(urng(), expected[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_counter)
+{
+    using engine = boost::random::threefry4x64;
+    const std::uint64_t ones = ~UINT64_C(0);
+
+    engine urng;
+    urng.set_counter({{ 0, 0, 0, 1000 }});
+    urng.discard(2);
+    engine urng2;
+    urng2.discard(4 * 1000 + 2);
+    BOOST_CHECK_EQUAL(urng, urng2);
+
+    // the carry crosses from the least to the most significant word
+    urng.set_counter({{ 0, ones, ones, ones }});
+    urng.discard(4);
+    urng2.set_counter({{ 1, 0, 0, 0 }});
+    BOOST_CHECK_EQUAL(urng, urng2);
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate)
+{
+    // lengths straddling block and vector boundaries, into both a raw
+    // array and a container of a different integer type, with the low
+    // word of the counter wrapping in every other run
+    const std::size_t lengths[] = { 1, 3, 4, 5, 31, 64, 67, 1000 };
+    for (std::size_t k = 0; k < 2 * sizeof(lengths) / sizeof(lengths[0]); ++k)
+    {
+        boost::random::threefry4x64 urng;
+        if (k % 2 == 1)
+        {
+            urng.set_counter({{ 0, 0, 1, ~UINT64_C(0) - 5 }});
+        }
+        urng();
+        boost::random::threefry4x64 urng2(urng);
+        boost::random::threefry4x64 urng3(urng);
+        std::vector<std::uint64_t> contiguous(lengths[k / 2]);
+        std::vector<unsigned long long> converted(lengths[k / 2]);
+        urng2.generate(&contiguous[0], &contiguous[0] + contiguous.size());
+        urng3.generate(converted.begin(), converted.end());
+        for (std::size_t i = 0; i < lengths[k / 2]; ++i)
+        {
+            const std::uint64_t expected = urng();
+            BOOST_CHECK_EQUAL(contiguous[i], expected);
+            BOOST_CHECK_EQUAL(converted[i], expected);
+        }
+        BOOST_CHECK_EQUAL(urng, urng2);
+        BOOST_CHECK_EQUAL(urng, urng3);
+    }
+}
@@ -0,0 +1,25 @@
+/* test_wyrand.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/wyrand.hpp>
+#include <cstdint>
+
+#define BOOST_RANDOM_URNG boost::random::wyrand
+
+// values by experiment
+#define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(2003155139336213477)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(7830677271398513432)
+
+// exercises the constant time discard
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
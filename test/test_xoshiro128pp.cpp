@@ -21,4 +21,8 @@
 #define BOOST_RANDOM_VALIDATION_VALUE UINT32_C(1247534874)
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT32_C(393602294)
 
+// exercises the polynomial jump-ahead
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #include "test_generator.ipp"
@@ -25,4 +25,8 @@
 // The test harness only allows for 32 bit seeds
 #define BOOST_RANDOM_PROVIDED_SEED_TYPE std::uint64_t
 
+// exercises the polynomial jump-ahead
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #include "test_generator.ipp"
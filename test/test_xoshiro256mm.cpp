@@ -21,4 +21,8 @@
 #define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(2196391076106727935)
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(8340052881247508375)
 
+// exercises the polynomial jump-ahead
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #include "test_generator.ipp"
@@ -21,4 +21,8 @@
 #define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(9446215307655316885)
 #define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(7700017102361224222)
 
+// exercises the polynomial jump-ahead
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
 #include "test_generator.ipp"
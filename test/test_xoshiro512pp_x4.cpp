@@ -0,0 +1,69 @@
+/* test_xoshiro512pp_x4.cpp
+ *
+ * Copyright Matt Borland 2025
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * $Id$
+ *
+ */
+
+#include <boost/random/xoshiro_lanes.hpp>
+#include <cstdint>
+#include <vector>
+
+#define BOOST_RANDOM_URNG boost::random::xoshiro512pp_x4
+#define BOOST_RANDOM_CPP11_URNG
+
+// values by experiment: lane 9999 % 4 of xoshiro512pp, advanced 9999 / 4 steps
+#define BOOST_RANDOM_VALIDATION_VALUE UINT64_C(5573139585193902965)
+#define BOOST_RANDOM_SEED_SEQ_VALIDATION_VALUE UINT64_C(1628638119106492963)
+
+// exercises the polynomial jump-ahead
+#define BOOST_RANDOM_DISCARD_COUNT2 1000000
+#define BOOST_RANDOM_DISCARD_MAX
+
+#include "test_generator.ipp"
+
+BOOST_AUTO_TEST_CASE(test_lane_order)
+{
+    boost::random::xoshiro512pp lanes[4];
+    for (std::size_t i = 1; i < 4; ++i)
+    {
+        lanes[i] = lanes[i - 1];
+        lanes[i].jump();
+    }
+
+    BOOST_RANDOM_URNG urng;
+    for (int i = 0; i < 1000; ++i)
+    {
+        BOOST_CHECK_EQUAL(urng(), lanes[i % 4]());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_bulk_generate)
+{
+    BOOST_RANDOM_URNG urng;
+    BOOST_RANDOM_URNG urng2;
+    BOOST_RANDOM_URNG urng3;
+
+    // start mid-block so that both the scalar head and tail are exercised
+    urng();
+    urng2();
+    urng3();
+
+    std::vector<std::uint64_t> contiguous(1027);
+    std::vector<unsigned long long> converted(1027);
+    urng2.generate(contiguous.data(), contiguous.data() + contiguous.size());
+    urng3.generate(converted.begin(), converted.end());
+
+    for (std::size_t i = 0; i < contiguous.size(); ++i)
+    {
+        const std::uint64_t expected = urng();
+        BOOST_CHECK_EQUAL(contiguous[i], expected);
+        BOOST_CHECK_EQUAL(converted[i], expected);
+    }
+    BOOST_CHECK_EQUAL(urng, urng2);
+    BOOST_CHECK_EQUAL(urng, urng3);
+}